@@ -0,0 +1,124 @@
+#include <malloc.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "alloc_stats.h"
+
+static bool enabled;
+static AllocStats stats;
+// Usable bytes currently held, may go below zero when blocks allocated before
+// enabling are freed
+static long current_bytes;
+// Windows are per thread, each sees the heap growth of the whole process
+static __thread long window_base;
+static __thread long window_peak;
+
+// Sanitizers bring their own allocator, so the wrappers are left out and the
+// counters stay at zero
+#if !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+// glibc entry points of the real allocator
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static void track_usage(long delta) {
+  long current =
+      __atomic_add_fetch(&current_bytes, delta, __ATOMIC_RELAXED);
+  if (current > window_peak) {
+    window_peak = current;
+  }
+  if (current <= 0) {
+    return;
+  }
+
+  size_t peak = __atomic_load_n(&stats.peak_bytes, __ATOMIC_RELAXED);
+  while ((size_t)current > peak &&
+         !__atomic_compare_exchange_n(&stats.peak_bytes, &peak,
+                                      (size_t)current, true, __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED)) {
+  }
+}
+
+static void count_alloc(size_t size, void *ptr) {
+  __atomic_fetch_add(&stats.allocs, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&stats.bytes, size, __ATOMIC_RELAXED);
+  if (ptr != NULL) {
+    track_usage((long)malloc_usable_size(ptr));
+  }
+}
+
+void *malloc(size_t size) {
+  void *ptr = __libc_malloc(size);
+  if (__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    count_alloc(size, ptr);
+  }
+  return ptr;
+}
+
+void *calloc(size_t nmemb, size_t size) {
+  void *ptr = __libc_calloc(nmemb, size);
+  if (__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    count_alloc(nmemb * size, ptr);
+  }
+  return ptr;
+}
+
+void *realloc(void *ptr, size_t size) {
+  if (!__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    return __libc_realloc(ptr, size);
+  }
+
+  long old_size = ptr ? (long)malloc_usable_size(ptr) : 0;
+  void *new_ptr = __libc_realloc(ptr, size);
+  if (new_ptr == NULL && size > 0) {
+    return NULL; // ptr is left untouched
+  }
+  __atomic_fetch_add(&stats.allocs, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&stats.bytes, size, __ATOMIC_RELAXED);
+  track_usage((new_ptr ? (long)malloc_usable_size(new_ptr) : 0) - old_size);
+  return new_ptr;
+}
+
+void free(void *ptr) {
+  if (ptr != NULL && __atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    __atomic_fetch_add(&stats.frees, 1, __ATOMIC_RELAXED);
+    track_usage(-(long)malloc_usable_size(ptr));
+  }
+  __libc_free(ptr);
+}
+#endif
+
+void alloc_stats_enable(void) {
+  __atomic_store_n(&enabled, true, __ATOMIC_RELAXED);
+}
+
+void alloc_stats_reset(void) {
+  __atomic_store_n(&stats.allocs, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&stats.frees, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&stats.bytes, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&stats.peak_bytes, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&current_bytes, 0, __ATOMIC_RELAXED);
+}
+
+AllocStats alloc_stats_get(void) {
+  AllocStats snapshot;
+  snapshot.allocs = __atomic_load_n(&stats.allocs, __ATOMIC_RELAXED);
+  snapshot.frees = __atomic_load_n(&stats.frees, __ATOMIC_RELAXED);
+  snapshot.bytes = __atomic_load_n(&stats.bytes, __ATOMIC_RELAXED);
+  snapshot.peak_bytes = __atomic_load_n(&stats.peak_bytes, __ATOMIC_RELAXED);
+  return snapshot;
+}
+
+long alloc_stats_current(void) {
+  return __atomic_load_n(&current_bytes, __ATOMIC_RELAXED);
+}
+
+void alloc_stats_window_begin(void) {
+  window_base = __atomic_load_n(&current_bytes, __ATOMIC_RELAXED);
+  window_peak = window_base;
+}
+
+size_t alloc_stats_window_end(void) {
+  return window_peak > window_base ? (size_t)(window_peak - window_base) : 0;
+}
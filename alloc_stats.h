@@ -0,0 +1,27 @@
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#include <stddef.h>
+
+// Counters kept by the malloc family wrappers in alloc_stats.c once enabled.
+// Only binaries linking alloc_stats.o go through the wrappers.
+typedef struct {
+  size_t allocs; // malloc, calloc and realloc calls
+  size_t frees;
+  size_t bytes;      // bytes requested by allocs
+  size_t peak_bytes; // highest usable heap size held at once since enabled
+} AllocStats;
+
+void alloc_stats_enable(void);
+void alloc_stats_reset(void);
+AllocStats alloc_stats_get(void);
+
+// Usable heap bytes currently held since enabling
+long alloc_stats_current(void);
+// A window tracks the highest heap size reached above its starting point,
+// used to measure the temporaries of a single call. Windows are per thread
+// and do not nest.
+void alloc_stats_window_begin(void);
+size_t alloc_stats_window_end(void);
+
+#endif
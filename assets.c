@@ -0,0 +1,82 @@
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "assets.h"
+#include "logger.h"
+#include "page_html.h"
+#include "str_utils.h"
+
+// write_asset writes data to dir as mthc-theme.HASH.EXT and stores that name
+// in name. A file is named by its content, so browsers may cache it for good
+// and an existing one is kept as it is. Returns 0 on success, -1 on error.
+static int write_asset(const char *dir, const char *ext, const void *data,
+                       size_t len, char *name) {
+  snprintf(name, ASSET_NAME_MAX, "mthc-theme.%012" PRIx64 ".%s",
+           fnv1a64(data, len, FNV1A64_SEED) >> 16, ext);
+  size_t path_len = strlen(dir) + 1 + ASSET_NAME_MAX + 32;
+  char *path = malloc(path_len);
+  char *tmp_path = malloc(path_len);
+  if (!path || !tmp_path) {
+    perror("malloc failed");
+    free(path);
+    free(tmp_path);
+    return -1;
+  }
+  snprintf(path, path_len, "%s/%s", dir, name);
+  snprintf(tmp_path, path_len, "%s/.%s.%ld", dir, name, (long)getpid());
+
+  int status = 0;
+  struct stat st;
+  if (stat(path, &st) == 0 && st.st_size == (off_t)len) {
+    LOGF("Theme file %s is up to date\n", path);
+  } else {
+    // Renamed into place, pages being served never see a partial file
+    FILE *fp = fopen(tmp_path, "wb");
+    if (!fp) {
+      fprintf(stderr, "Failed to create theme file %s: %s\n", tmp_path,
+              strerror(errno));
+      status = -1;
+    } else {
+      bool failed = fwrite(data, 1, len, fp) != len;
+      if (fclose(fp) != 0 || failed || rename(tmp_path, path) != 0) {
+        fprintf(stderr, "Failed to write theme file %s: %s\n", path,
+                strerror(errno));
+        unlink(tmp_path);
+        status = -1;
+      }
+    }
+  }
+
+  free(path);
+  free(tmp_path);
+  return status;
+}
+
+// write_theme_assets writes the theme css and the theme toggler script to
+// dir once, for every page to link to instead of inlining them. The names
+// are stored in opts. Returns 0 on success, -1 on error.
+int write_theme_assets(const char *dir, HtmlOptions *opts) {
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Failed to create output directory: %s: %s\n", dir,
+            strerror(errno));
+    return -1;
+  }
+
+  int status = 0;
+  if (write_asset(dir, "css", opts->css_theme, opts->css_theme_len,
+                  opts->css_file) != 0 ||
+      write_asset(dir, "js", minify_html ? theme_script_js_min : theme_script_js,
+                  minify_html ? theme_script_js_min_len : theme_script_js_len,
+                  opts->js_file) != 0) {
+    opts->css_file[0] = '\0';
+    opts->js_file[0] = '\0';
+    status = -1;
+  }
+  return status;
+}
@@ -0,0 +1,8 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "html_writer.h"
+
+int write_theme_assets(const char *dir, HtmlOptions *opts);
+
+#endif
@@ -0,0 +1,358 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ast.h"
+
+// Tags are few and repeat on every block, they are stored once each
+#define MAX_SHARED_TAGS 32
+
+typedef struct {
+  AstNode *nodes;
+  size_t node_count;
+  size_t node_capacity;
+  uint32_t *lines;
+  size_t line_count;
+  size_t line_capacity;
+  char *strings;
+  size_t string_bytes;
+  size_t string_capacity;
+  uint32_t tags[MAX_SHARED_TAGS];
+  int tag_count;
+  bool failed;
+} AstWriter;
+
+static bool grow(void **items, size_t *capacity, size_t needed, size_t size) {
+  if (needed <= *capacity) {
+    return true;
+  }
+  size_t new_capacity = *capacity ? *capacity * 2 : 256;
+  while (new_capacity < needed) {
+    new_capacity *= 2;
+  }
+  void *tmp = realloc(*items, new_capacity * size);
+  if (!tmp) {
+    perror("Unable to reallocate ast buffer");
+    return false;
+  }
+  *items = tmp;
+  *capacity = new_capacity;
+  return true;
+}
+
+static uint32_t add_string(AstWriter *w, const char *str) {
+  if (str == NULL || w->failed) {
+    return AST_NONE;
+  }
+  size_t len = strlen(str) + 1;
+  if (w->string_bytes + len >= AST_NONE ||
+      !grow((void **)&w->strings, &w->string_capacity, w->string_bytes + len,
+            1)) {
+    w->failed = true;
+    return AST_NONE;
+  }
+  uint32_t offset = (uint32_t)w->string_bytes;
+  memcpy(w->strings + offset, str, len);
+  w->string_bytes += len;
+  return offset;
+}
+
+static uint32_t add_tag(AstWriter *w, const char *tag) {
+  if (tag == NULL) {
+    return AST_NONE;
+  }
+  for (int i = 0; i < w->tag_count; i++) {
+    if (strcmp(w->strings + w->tags[i], tag) == 0) {
+      return w->tags[i];
+    }
+  }
+  uint32_t offset = add_string(w, tag);
+  if (offset != AST_NONE && w->tag_count < MAX_SHARED_TAGS) {
+    w->tags[w->tag_count++] = offset;
+  }
+  return offset;
+}
+
+static void add_lines(AstWriter *w, AstNode *node, const LineList *lines) {
+  node->lines = AST_NONE;
+  node->line_count = 0;
+  if (lines == NULL) {
+    return;
+  }
+  if (!grow((void **)&w->lines, &w->line_capacity,
+            w->line_count + lines->count, sizeof(uint32_t))) {
+    w->failed = true;
+    return;
+  }
+  node->lines = (uint32_t)w->line_count;
+  node->line_count = lines->count;
+  for (int i = 0; i < lines->count; i++) {
+    w->lines[w->line_count++] = add_string(w, lines->lines[i]);
+  }
+}
+
+// add_chain numbers block, its descendants and the blocks following it in
+// pre-order. Returns the index of block.
+static uint32_t add_chain(AstWriter *w, const MDBlock *block) {
+  uint32_t first = AST_NONE;
+  uint32_t prev = AST_NONE;
+  for (; block != NULL && !w->failed; block = block->next) {
+    // Section breaks and link references render to nothing. The first
+    // block of a chain is kept, whether a chain is empty changes the html.
+    if (prev != AST_NONE &&
+        (block->block == SECTION_BREAK || block->block == LINK_REFERENCE)) {
+      continue;
+    }
+    if (w->node_count >= AST_NONE ||
+        !grow((void **)&w->nodes, &w->node_capacity, w->node_count + 1,
+              sizeof(AstNode))) {
+      w->failed = true;
+      break;
+    }
+    uint32_t index = (uint32_t)w->node_count++;
+    if (prev == AST_NONE) {
+      first = index;
+    } else {
+      w->nodes[prev].next = index;
+    }
+
+    AstNode node = {.block = (uint8_t)block->block,
+                    .type = (uint8_t)block->type,
+                    .child = AST_NONE,
+                    .next = AST_NONE};
+    node.content = add_string(w, block->content);
+    node.tag = add_tag(w, block->tag);
+    // Container lines were parsed into the children, only code and raw
+    // html blocks are rendered from their lines
+    add_lines(w, &node,
+              block->block == CODEBLOCK || block->block == HTML_TAG
+                  ? block->lines
+                  : NULL);
+    w->nodes[index] = node;
+    // Adding the children may move the nodes
+    uint32_t child = add_chain(w, block->child);
+    w->nodes[index].child = child;
+    prev = index;
+  }
+  return first;
+}
+
+// write_ast writes the block tree from head to path. Returns 0 on success,
+// -1 on error.
+int write_ast(const char *path, const MDBlock *head) {
+  AstWriter w = {0};
+  uint32_t head_index = add_chain(&w, head);
+
+  int status = -1;
+  if (w.failed) {
+    fprintf(stderr, "Failed to serialise the block tree\n");
+  } else {
+    AstHeader header = {.magic = AST_MAGIC,
+                        .version = AST_VERSION,
+                        .byte_order = AST_BYTE_ORDER,
+                        .node_count = (uint32_t)w.node_count,
+                        .line_count = (uint32_t)w.line_count,
+                        .string_bytes = (uint32_t)w.string_bytes,
+                        .head = head_index};
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+      fprintf(stderr, "Failed to open ast file: %s\n", path);
+    } else {
+      fwrite(&header, sizeof(header), 1, fp);
+      if (w.node_count > 0) {
+        fwrite(w.nodes, sizeof(AstNode), w.node_count, fp);
+      }
+      if (w.line_count > 0) {
+        fwrite(w.lines, sizeof(uint32_t), w.line_count, fp);
+      }
+      if (w.string_bytes > 0) {
+        fwrite(w.strings, 1, w.string_bytes, fp);
+      }
+      bool failed = ferror(fp);
+      if (fclose(fp) == 0 && !failed) {
+        status = 0;
+      } else {
+        fprintf(stderr, "Failed to write ast file %s: %s\n", path,
+                strerror(errno));
+      }
+    }
+  }
+
+  free(w.nodes);
+  free(w.lines);
+  free(w.strings);
+  return status;
+}
+
+static bool valid_string(const AstHeader *header, uint32_t offset) {
+  return offset == AST_NONE || offset < header->string_bytes;
+}
+
+// valid_ast checks every offset and index, the string table ends with '\0'
+// so every string in it is terminated
+static bool valid_ast(const AstHeader *header, size_t size) {
+  if (size < sizeof(AstHeader) ||
+      memcmp(header->magic, AST_MAGIC, sizeof(AST_MAGIC)) != 0 ||
+      header->version != AST_VERSION ||
+      header->byte_order != AST_BYTE_ORDER) {
+    return false;
+  }
+  size_t expected = sizeof(AstHeader) +
+                    (size_t)header->node_count * sizeof(AstNode) +
+                    (size_t)header->line_count * sizeof(uint32_t) +
+                    header->string_bytes;
+  if (expected != size) {
+    return false;
+  }
+
+  const AstNode *nodes = (const AstNode *)(header + 1);
+  const uint32_t *lines = (const uint32_t *)(nodes + header->node_count);
+  const char *strings = (const char *)(lines + header->line_count);
+  if (header->string_bytes > 0 && strings[header->string_bytes - 1] != '\0') {
+    return false;
+  }
+  if (header->head != AST_NONE && header->head >= header->node_count) {
+    return false;
+  }
+
+  // Links point forward and reach every node at most once, so the blocks
+  // form a tree
+  bool *linked = calloc(header->node_count + 1, sizeof(bool));
+  if (!linked) {
+    perror("calloc failed");
+    return false;
+  }
+  bool valid = true;
+  for (uint32_t i = 0; i < header->node_count && valid; i++) {
+    const AstNode *node = &nodes[i];
+    uint32_t links[] = {node->child, node->next};
+    for (int j = 0; j < 2; j++) {
+      if (links[j] == AST_NONE) {
+        continue;
+      }
+      if (links[j] <= i || links[j] >= header->node_count ||
+          linked[links[j]]) {
+        valid = false;
+      } else {
+        linked[links[j]] = true;
+      }
+    }
+    if (!valid_string(header, node->content) ||
+        !valid_string(header, node->tag) ||
+        (node->lines != AST_NONE &&
+         (node->lines > header->line_count ||
+          node->line_count > header->line_count - node->lines))) {
+      valid = false;
+    }
+  }
+  if (header->head != AST_NONE && linked[header->head]) {
+    valid = false;
+  }
+  free(linked);
+  if (!valid) {
+    return false;
+  }
+  for (uint32_t i = 0; i < header->line_count; i++) {
+    if (lines[i] == AST_NONE || !valid_string(header, lines[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static char *string_at(const char *strings, uint32_t offset) {
+  return offset == AST_NONE ? NULL : (char *)strings + offset;
+}
+
+// load_ast maps the file at path and rebuilds its block tree. Returns NULL
+// if it cannot be read or is not a valid ast file.
+AstDocument *load_ast(const char *path) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    fprintf(stderr, "Failed to open ast file: %s\n", path);
+    return NULL;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(AstHeader)) {
+    fprintf(stderr, "Invalid ast file: %s\n", path);
+    close(fd);
+    return NULL;
+  }
+  void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    perror("mmap failed");
+    return NULL;
+  }
+
+  const AstHeader *header = map;
+  if (!valid_ast(header, st.st_size)) {
+    fprintf(stderr, "Invalid ast file: %s\n", path);
+    munmap(map, st.st_size);
+    return NULL;
+  }
+  const AstNode *nodes = (const AstNode *)(header + 1);
+  const uint32_t *line_table = (const uint32_t *)(nodes + header->node_count);
+  const char *strings = (const char *)(line_table + header->line_count);
+
+  AstDocument *doc = calloc(1, sizeof(AstDocument));
+  if (doc) {
+    doc->blocks = calloc(header->node_count + 1, sizeof(MDBlock));
+    doc->line_lists = calloc(header->node_count + 1, sizeof(LineList));
+    doc->lines = calloc(header->line_count + 1, sizeof(char *));
+  }
+  if (!doc || !doc->blocks || !doc->line_lists || !doc->lines) {
+    perror("calloc failed");
+    if (doc) {
+      free(doc->blocks);
+      free(doc->line_lists);
+      free(doc->lines);
+      free(doc);
+    }
+    munmap(map, st.st_size);
+    return NULL;
+  }
+  doc->map = map;
+  doc->size = st.st_size;
+
+  for (uint32_t i = 0; i < header->line_count; i++) {
+    doc->lines[i] = string_at(strings, line_table[i]);
+  }
+  for (uint32_t i = 0; i < header->node_count; i++) {
+    const AstNode *node = &nodes[i];
+    MDBlock *block = &doc->blocks[i];
+    block->content = string_at(strings, node->content);
+    block->tag = string_at(strings, node->tag);
+    block->block = node->block;
+    block->type = node->type;
+    block->child =
+        node->child == AST_NONE ? NULL : &doc->blocks[node->child];
+    block->next = node->next == AST_NONE ? NULL : &doc->blocks[node->next];
+    if (node->lines != AST_NONE) {
+      LineList *lines = &doc->line_lists[i];
+      lines->lines = doc->lines + node->lines;
+      lines->count = node->line_count;
+      lines->capacity = node->line_count;
+      block->lines = lines;
+    }
+  }
+  doc->head = header->head == AST_NONE ? NULL : &doc->blocks[header->head];
+  return doc;
+}
+
+void free_ast_document(AstDocument *doc) {
+  if (doc == NULL) {
+    return;
+  }
+
+  free(doc->blocks);
+  free(doc->line_lists);
+  free(doc->lines);
+  munmap(doc->map, doc->size);
+  free(doc);
+}
@@ -0,0 +1,55 @@
+#ifndef AST_H
+#define AST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "md_parser.h"
+
+// Binary form of a parsed and inline parsed block tree, read back with mmap
+// and rendered without parsing. The file is the header, the nodes, the line
+// table and the string table, in that order. Nodes are numbered in pre-order
+// so child and next always point forward. Numbers are in host byte order.
+#define AST_MAGIC "MTHCAST"
+#define AST_VERSION 1
+#define AST_BYTE_ORDER 0x01020304u
+#define AST_NONE UINT32_MAX
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t node_count;
+  uint32_t line_count;
+  uint32_t string_bytes;
+  uint32_t head; // first top level node, AST_NONE for an empty document
+} AstHeader;
+
+typedef struct {
+  uint32_t content; // string table offsets, AST_NONE for NULL
+  uint32_t tag;
+  uint32_t child; // node indices
+  uint32_t next;
+  uint32_t lines; // first line table entry, AST_NONE without a line list
+  uint32_t line_count;
+  uint8_t block; // BlockTag
+  uint8_t type;  // TagType
+  uint16_t reserved;
+} AstNode;
+
+// Blocks rebuilt over a mapped file, their strings point into the mapping.
+// Only free_ast_document releases them, never free_mdblocks.
+typedef struct {
+  MDBlock *head;
+  MDBlock *blocks;
+  LineList *line_lists;
+  char **lines;
+  void *map;
+  size_t size;
+} AstDocument;
+
+int write_ast(const char *path, const MDBlock *head);
+AstDocument *load_ast(const char *path);
+void free_ast_document(AstDocument *doc);
+
+#endif
@@ -0,0 +1,644 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "batch_io.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(IO_URING_OP_SUPPORTED)
+#define HAVE_IO_URING 1
+#endif
+#endif
+
+#define MIN_READ_CAPACITY 4096
+// Largest single read or write, longer files take several
+#define MAX_IO_CHUNK (1U << 30)
+
+struct BatchIO {
+  bool uring;
+#ifdef HAVE_IO_URING
+  int ring_fd;
+  unsigned sq_entries;
+  unsigned *sq_head;
+  unsigned *sq_tail;
+  unsigned *sq_mask;
+  unsigned *sq_array;
+  struct io_uring_sqe *sqes;
+  unsigned *cq_head;
+  unsigned *cq_tail;
+  unsigned *cq_mask;
+  struct io_uring_cqe *cqes;
+  void *sq_ring;
+  size_t sq_ring_size;
+  void *cq_ring; // sq_ring when the kernel maps both rings at once
+  size_t cq_ring_size;
+  size_t sqes_size;
+#endif
+};
+
+// read_file_plain reads the whole file with plain system calls, until the
+// end of file so pipes and files still growing work as well
+static void read_file_plain(BatchFile *file) {
+  int fd = open(file->path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    file->error = errno;
+    return;
+  }
+
+  struct stat st;
+  size_t capacity = MIN_READ_CAPACITY;
+  if (fstat(fd, &st) == 0 && (size_t)st.st_size >= capacity) {
+    capacity = st.st_size + 1;
+  }
+  file->data = malloc(capacity);
+  file->len = 0;
+  if (!file->data) {
+    file->error = ENOMEM;
+    close(fd);
+    return;
+  }
+
+  for (;;) {
+    if (file->len + 1 == capacity) {
+      capacity *= 2;
+      char *data = realloc(file->data, capacity);
+      if (!data) {
+        file->error = ENOMEM;
+        break;
+      }
+      file->data = data;
+    }
+    ssize_t n = read(fd, file->data + file->len, capacity - file->len - 1);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      file->error = errno;
+      break;
+    }
+    if (n == 0) {
+      break;
+    }
+    file->len += n;
+  }
+  close(fd);
+
+  if (file->error != 0) {
+    free(file->data);
+    file->data = NULL;
+    file->len = 0;
+    return;
+  }
+  file->data[file->len] = '\0';
+}
+
+static void write_file_plain(BatchFile *file) {
+  int fd = open(file->path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    file->error = errno;
+    return;
+  }
+
+  size_t done = 0;
+  while (done < file->len) {
+    ssize_t n = write(fd, file->data + done, file->len - done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      file->error = n < 0 ? errno : EIO;
+      break;
+    }
+    done += n;
+  }
+  if (close(fd) != 0 && file->error == 0) {
+    file->error = errno;
+  }
+}
+
+#ifdef HAVE_IO_URING
+
+// One submission queue entry, res gets the completion result
+typedef struct {
+  uint8_t opcode;
+  int fd;
+  const void *addr; // path or buffer
+  uint32_t len;     // byte count, open mode or statx mask
+  uint64_t off;     // file offset or statx buffer
+  uint32_t flags;   // open flags
+  int res;
+} RingOp;
+
+// The result of an operation not completed yet, no system call returns it
+#define RING_PENDING INT_MIN
+
+static int uring_setup(unsigned entries, struct io_uring_params *params) {
+  return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int uring_enter(int fd, unsigned to_submit, unsigned min_complete) {
+  return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                      IORING_ENTER_GETEVENTS, NULL, 0);
+}
+
+// Every operation a batch uses, the oldest ones need Linux 5.6
+static bool uring_supports_ops(int fd) {
+  static const uint8_t needed[] = {IORING_OP_OPENAT, IORING_OP_STATX,
+                                   IORING_OP_READ, IORING_OP_WRITE,
+                                   IORING_OP_CLOSE};
+  size_t size = sizeof(struct io_uring_probe) +
+                IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe *probe = calloc(1, size);
+  if (!probe) {
+    return false;
+  }
+
+  bool supported = syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE,
+                           probe, IORING_OP_LAST) == 0;
+  for (size_t i = 0; supported && i < sizeof(needed); i++) {
+    supported = needed[i] < probe->ops_len &&
+                (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+  }
+  free(probe);
+  return supported;
+}
+
+static void uring_unmap(BatchIO *io) {
+  if (io->sqes != NULL && io->sqes != MAP_FAILED) {
+    munmap(io->sqes, io->sqes_size);
+  }
+  if (io->cq_ring != NULL && io->cq_ring != MAP_FAILED &&
+      io->cq_ring != io->sq_ring) {
+    munmap(io->cq_ring, io->cq_ring_size);
+  }
+  if (io->sq_ring != NULL && io->sq_ring != MAP_FAILED) {
+    munmap(io->sq_ring, io->sq_ring_size);
+  }
+  close(io->ring_fd);
+}
+
+// uring_init maps the rings of a new io_uring instance, false when io_uring
+// is missing or blocked, as it often is in containers
+static bool uring_init(BatchIO *io) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  // Room for the open and statx of every file of a batch in one submission
+  io->ring_fd = uring_setup(BATCH_IO_DEPTH * 2, &params);
+  if (io->ring_fd < 0) {
+    return false;
+  }
+  if (!uring_supports_ops(io->ring_fd)) {
+    close(io->ring_fd);
+    return false;
+  }
+
+  io->sq_entries = params.sq_entries;
+  io->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  io->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap && io->cq_ring_size > io->sq_ring_size) {
+    io->sq_ring_size = io->cq_ring_size;
+  }
+
+  io->sq_ring = mmap(NULL, io->sq_ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, io->ring_fd, IORING_OFF_SQ_RING);
+  if (io->sq_ring == MAP_FAILED) {
+    uring_unmap(io);
+    return false;
+  }
+  io->cq_ring = single_mmap
+                    ? io->sq_ring
+                    : mmap(NULL, io->cq_ring_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, io->ring_fd,
+                           IORING_OFF_CQ_RING);
+  io->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  io->sqes = mmap(NULL, io->sqes_size, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, io->ring_fd, IORING_OFF_SQES);
+  if (io->cq_ring == MAP_FAILED || io->sqes == MAP_FAILED) {
+    uring_unmap(io);
+    return false;
+  }
+
+  char *sq = io->sq_ring;
+  char *cq = io->cq_ring;
+  io->sq_head = (unsigned *)(sq + params.sq_off.head);
+  io->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+  io->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+  io->sq_array = (unsigned *)(sq + params.sq_off.array);
+  io->cq_head = (unsigned *)(cq + params.cq_off.head);
+  io->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+  io->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+  io->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+  return true;
+}
+
+static unsigned uring_reap(BatchIO *io, RingOp *ops) {
+  unsigned head = *io->cq_head;
+  unsigned reaped = 0;
+  while (head != __atomic_load_n(io->cq_tail, __ATOMIC_ACQUIRE)) {
+    struct io_uring_cqe *cqe = &io->cqes[head & *io->cq_mask];
+    ops[cqe->user_data].res = cqe->res;
+    head++;
+    reaped++;
+  }
+  __atomic_store_n(io->cq_head, head, __ATOMIC_RELEASE);
+  return reaped;
+}
+
+// run_op_plain runs op with the plain system call it stands for
+static int run_op_plain(const RingOp *op) {
+  int ret;
+  switch (op->opcode) {
+  case IORING_OP_OPENAT:
+    ret = openat(op->fd, op->addr, (int)op->flags, (mode_t)op->len);
+    break;
+  case IORING_OP_STATX: {
+    struct stat st;
+    ret = fstatat(op->fd, op->addr, &st, 0);
+    if (ret == 0) {
+      struct statx *stx = (struct statx *)(uintptr_t)op->off;
+      stx->stx_mode = st.st_mode;
+      stx->stx_size = st.st_size;
+    }
+    break;
+  }
+  case IORING_OP_READ:
+    ret = (int)pread(op->fd, (void *)op->addr, op->len, op->off);
+    break;
+  case IORING_OP_WRITE:
+    ret = (int)pwrite(op->fd, op->addr, op->len, op->off);
+    break;
+  case IORING_OP_CLOSE:
+    ret = close(op->fd);
+    break;
+  default:
+    errno = EINVAL;
+    ret = -1;
+  }
+  return ret < 0 ? -errno : ret;
+}
+
+// uring_drain takes back the entries of a failed submission the kernel has
+// not consumed and waits for the consumed ones, the caller frees the buffers
+// they use once uring_run returns. If even waiting fails the ring is torn
+// down, which cancels them, and the rest of the batch uses plain calls.
+static void uring_drain(BatchIO *io, RingOp *ops, unsigned start,
+                        unsigned completed) {
+  unsigned head = __atomic_load_n(io->sq_head, __ATOMIC_ACQUIRE);
+  __atomic_store_n(io->sq_tail, head, __ATOMIC_RELEASE);
+  unsigned in_flight = head - start - completed;
+  while (in_flight > 0) {
+    int ret = uring_enter(io->ring_fd, 0, in_flight);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret < 0) {
+      perror("io_uring_enter failed");
+      uring_unmap(io);
+      io->uring = false;
+      return;
+    }
+    in_flight -= uring_reap(io, ops);
+  }
+}
+
+// uring_run submits the operations a queue full at a time and waits for all
+// of them, one io_uring_enter per queue in the common case. When a
+// submission fails, the operations already submitted are waited for and the
+// ones still pending get -errno.
+static void uring_run(BatchIO *io, RingOp *ops, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    ops[i].res = RING_PENDING;
+  }
+
+  for (size_t first = 0; first < count; first += io->sq_entries) {
+    if (!io->uring) {
+      for (size_t i = first; i < count; i++) {
+        ops[i].res = run_op_plain(&ops[i]);
+      }
+      return;
+    }
+
+    unsigned n = count - first < io->sq_entries ? count - first : io->sq_entries;
+    unsigned start = *io->sq_tail;
+    unsigned tail = start;
+    for (unsigned i = 0; i < n; i++) {
+      const RingOp *op = &ops[first + i];
+      unsigned index = tail & *io->sq_mask;
+      struct io_uring_sqe *sqe = &io->sqes[index];
+      memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = op->opcode;
+      sqe->fd = op->fd;
+      sqe->addr = (uintptr_t)op->addr;
+      sqe->len = op->len;
+      sqe->off = op->off;
+      sqe->open_flags = op->flags; // shares a union with statx and rw flags
+      sqe->user_data = first + i;
+      io->sq_array[index] = index;
+      tail++;
+    }
+    __atomic_store_n(io->sq_tail, tail, __ATOMIC_RELEASE);
+
+    unsigned submitted = 0;
+    unsigned completed = 0;
+    while (completed < n) {
+      int ret = uring_enter(io->ring_fd, n - submitted, n - completed);
+      if (ret < 0 && errno == EINTR) {
+        continue;
+      }
+      if (ret < 0) {
+        int err = errno;
+        perror("io_uring_enter failed");
+        uring_drain(io, ops, start, completed);
+        for (size_t i = first; i < count; i++) {
+          if (ops[i].res == RING_PENDING) {
+            ops[i].res = -err;
+          }
+        }
+        return;
+      }
+      submitted += ret;
+      completed += uring_reap(io, ops);
+    }
+  }
+}
+
+static RingOp open_op(const char *path, uint32_t flags, uint32_t mode) {
+  return (RingOp){.opcode = IORING_OP_OPENAT,
+                  .fd = AT_FDCWD,
+                  .addr = path,
+                  .len = mode,
+                  .flags = flags};
+}
+
+static RingOp close_op(int fd) {
+  return (RingOp){.opcode = IORING_OP_CLOSE, .fd = fd};
+}
+
+static uint32_t io_chunk(size_t remaining) {
+  return remaining < MAX_IO_CHUNK ? (uint32_t)remaining : MAX_IO_CHUNK;
+}
+
+// uring_read opens and sizes every file in one round, reads them in as many
+// rounds as short reads need and closes them in a last round
+static void uring_read(BatchIO *io, BatchFile *files, size_t count) {
+  RingOp *ops = calloc(count * 2, sizeof(RingOp));
+  struct statx *stats = calloc(count, sizeof(struct statx));
+  int *fds = malloc(count * sizeof(int));
+  size_t *owners = malloc(count * sizeof(size_t));
+  bool *plain = calloc(count, sizeof(bool)); // read until the end afterwards
+  if (!ops || !stats || !fds || !owners || !plain) {
+    free(ops);
+    free(stats);
+    free(fds);
+    free(owners);
+    free(plain);
+    for (size_t i = 0; i < count; i++) {
+      read_file_plain(&files[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    ops[2 * i] = open_op(files[i].path, O_RDONLY | O_CLOEXEC, 0);
+    ops[2 * i + 1] = (RingOp){.opcode = IORING_OP_STATX,
+                              .fd = AT_FDCWD,
+                              .addr = files[i].path,
+                              .len = STATX_TYPE | STATX_SIZE,
+                              .off = (uintptr_t)&stats[i]};
+  }
+  uring_run(io, ops, count * 2);
+
+  for (size_t i = 0; i < count; i++) {
+    BatchFile *file = &files[i];
+    fds[i] = ops[2 * i].res;
+    file->len = 0;
+    if (fds[i] < 0) {
+      file->error = -fds[i];
+    } else if (ops[2 * i + 1].res < 0) {
+      file->error = -ops[2 * i + 1].res;
+    } else if (!S_ISREG(stats[i].stx_mode)) {
+      plain[i] = true; // pipes and devices have no size to read up to
+    } else if (!(file->data = malloc(stats[i].stx_size + 1))) {
+      file->error = ENOMEM;
+    }
+  }
+
+  for (;;) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+      BatchFile *file = &files[i];
+      if (file->data == NULL || file->error != 0 ||
+          file->len == stats[i].stx_size) {
+        continue;
+      }
+      ops[n] = (RingOp){.opcode = IORING_OP_READ,
+                        .fd = fds[i],
+                        .addr = file->data + file->len,
+                        .len = io_chunk(stats[i].stx_size - file->len),
+                        .off = file->len};
+      owners[n++] = i;
+    }
+    if (n == 0) {
+      break;
+    }
+
+    uring_run(io, ops, n);
+    for (size_t j = 0; j < n; j++) {
+      size_t i = owners[j];
+      if (ops[j].res < 0) {
+        files[i].error = -ops[j].res;
+      } else if (ops[j].res == 0) {
+        stats[i].stx_size = files[i].len; // truncated since sized
+      } else {
+        files[i].len += ops[j].res;
+      }
+    }
+  }
+
+  size_t n = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (fds[i] >= 0) {
+      ops[n++] = close_op(fds[i]);
+    }
+  }
+  uring_run(io, ops, n);
+
+  for (size_t i = 0; i < count; i++) {
+    BatchFile *file = &files[i];
+    if (plain[i]) {
+      read_file_plain(file);
+    } else if (file->error != 0) {
+      free(file->data);
+      file->data = NULL;
+      file->len = 0;
+    } else {
+      file->data[file->len] = '\0';
+    }
+  }
+
+  free(plain);
+  free(ops);
+  free(stats);
+  free(fds);
+  free(owners);
+}
+
+// uring_write creates every file in one round, writes them in as many rounds
+// as short writes need and closes them in a last round
+static void uring_write(BatchIO *io, BatchFile *files, size_t count) {
+  RingOp *ops = calloc(count, sizeof(RingOp));
+  int *fds = malloc(count * sizeof(int));
+  size_t *done = calloc(count, sizeof(size_t));
+  size_t *owners = malloc(count * sizeof(size_t));
+  if (!ops || !fds || !done || !owners) {
+    free(ops);
+    free(fds);
+    free(done);
+    free(owners);
+    for (size_t i = 0; i < count; i++) {
+      write_file_plain(&files[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    ops[i] = open_op(files[i].path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                     0644);
+  }
+  uring_run(io, ops, count);
+  for (size_t i = 0; i < count; i++) {
+    fds[i] = ops[i].res;
+    if (fds[i] < 0) {
+      files[i].error = -fds[i];
+    }
+  }
+
+  for (;;) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (fds[i] < 0 || files[i].error != 0 || done[i] == files[i].len) {
+        continue;
+      }
+      ops[n] = (RingOp){.opcode = IORING_OP_WRITE,
+                        .fd = fds[i],
+                        .addr = files[i].data + done[i],
+                        .len = io_chunk(files[i].len - done[i]),
+                        .off = done[i]};
+      owners[n++] = i;
+    }
+    if (n == 0) {
+      break;
+    }
+
+    uring_run(io, ops, n);
+    for (size_t j = 0; j < n; j++) {
+      size_t i = owners[j];
+      if (ops[j].res <= 0) {
+        files[i].error = ops[j].res < 0 ? -ops[j].res : EIO;
+      } else {
+        done[i] += ops[j].res;
+      }
+    }
+  }
+
+  size_t n = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (fds[i] >= 0) {
+      ops[n] = close_op(fds[i]);
+      owners[n++] = i;
+    }
+  }
+  uring_run(io, ops, n);
+  for (size_t j = 0; j < n; j++) {
+    if (ops[j].res < 0 && files[owners[j]].error == 0) {
+      files[owners[j]].error = -ops[j].res;
+    }
+  }
+
+  free(ops);
+  free(fds);
+  free(done);
+  free(owners);
+}
+
+#endif
+
+// new_batch_io falls back to plain system calls when use_uring is false or
+// io_uring cannot be set up. Returns NULL on error.
+BatchIO *new_batch_io(bool use_uring) {
+  BatchIO *io = calloc(1, sizeof(BatchIO));
+  if (!io) {
+    perror("calloc failed");
+    return NULL;
+  }
+#ifdef HAVE_IO_URING
+  io->uring = use_uring && uring_init(io);
+#else
+  (void)use_uring;
+#endif
+  return io;
+}
+
+void free_batch_io(BatchIO *io) {
+  if (io == NULL) {
+    return;
+  }
+#ifdef HAVE_IO_URING
+  if (io->uring) {
+    uring_unmap(io);
+  }
+#endif
+  free(io);
+}
+
+bool batch_io_uses_uring(const BatchIO *io) { return io->uring; }
+
+// batch_io_read reads every file whole into its data, failures are left in
+// error with data NULL
+void batch_io_read(BatchIO *io, BatchFile *files, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    files[i].data = NULL;
+    files[i].len = 0;
+    files[i].error = 0;
+  }
+#ifdef HAVE_IO_URING
+  if (io->uring) {
+    uring_read(io, files, count);
+    return;
+  }
+#endif
+  (void)io;
+  for (size_t i = 0; i < count; i++) {
+    read_file_plain(&files[i]);
+  }
+}
+
+// batch_io_write creates or truncates every file and writes its data,
+// failures are left in error
+void batch_io_write(BatchIO *io, BatchFile *files, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    files[i].error = 0;
+  }
+#ifdef HAVE_IO_URING
+  if (io->uring) {
+    uring_write(io, files, count);
+    return;
+  }
+#endif
+  (void)io;
+  for (size_t i = 0; i < count; i++) {
+    write_file_plain(&files[i]);
+  }
+}
@@ -0,0 +1,32 @@
+#ifndef BATCH_IO_H
+#define BATCH_IO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Files read or written as a whole, in batches. On Linux the opens, reads,
+// writes and closes of a batch are submitted through io_uring, a handful of
+// system calls for the whole batch. Without io_uring every file takes plain
+// open, read or write and close calls.
+typedef struct {
+  const char *path;
+  char *data; // read: allocated with a '\0' after len bytes, write: borrowed
+  size_t len;
+  int error; // errno of the first failed step, 0 on success
+} BatchFile;
+
+typedef struct BatchIO BatchIO;
+
+// Files per batch, also the io_uring submission queue size
+#ifndef BATCH_IO_DEPTH
+#define BATCH_IO_DEPTH 64
+#endif
+
+BatchIO *new_batch_io(bool use_uring);
+void free_batch_io(BatchIO *io);
+bool batch_io_uses_uring(const BatchIO *io);
+
+void batch_io_read(BatchIO *io, BatchFile *files, size_t count);
+void batch_io_write(BatchIO *io, BatchFile *files, size_t count);
+
+#endif
@@ -0,0 +1,565 @@
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "block_cache.h"
+#include "html_writer.h"
+#include "logger.h"
+#include "stats.h"
+#include "str_utils.h"
+#include "trace.h"
+
+// Entries start with this header, followed by the key and the html. The key
+// is kept in full so a hash collision is a miss, not a wrong block.
+#define ENTRY_HEADER "mthc-cache 1 %zu %zu\n"
+
+struct BlockCache {
+  char *dir;
+  size_t max_bytes;
+  unsigned int tmp_count;
+  size_t hits;
+  size_t misses;
+  size_t stored;
+};
+
+typedef struct {
+  char *path;
+  off_t size;
+  struct timespec used; // mtime, refreshed on every hit
+} CacheEntry;
+
+// Entries are spread over 256 subdirectories by the top byte of the hash
+static char *entry_path(const BlockCache *cache, uint64_t hash, bool subdir) {
+  size_t len = strlen(cache->dir) + 4 + 16 + 1;
+  char *path = malloc(len);
+  if (!path) {
+    perror("malloc failed");
+    return NULL;
+  }
+  if (subdir) {
+    snprintf(path, len, "%s/%02x", cache->dir, (unsigned int)(hash >> 56));
+  } else {
+    snprintf(path, len, "%s/%02x/%016" PRIx64, cache->dir,
+             (unsigned int)(hash >> 56), hash);
+  }
+  return path;
+}
+
+// open_block_cache uses dir, created if missing, as a cache of at most
+// max_bytes. Returns NULL if dir cannot be created.
+BlockCache *open_block_cache(const char *dir, size_t max_bytes) {
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Failed to create cache directory %s: %s\n", dir,
+            strerror(errno));
+    return NULL;
+  }
+
+  BlockCache *cache = calloc(1, sizeof(BlockCache));
+  if (!cache) {
+    perror("calloc failed");
+    return NULL;
+  }
+  cache->dir = strdup(dir);
+  if (!cache->dir) {
+    perror("strdup failed");
+    free(cache);
+    return NULL;
+  }
+  cache->max_bytes = max_bytes;
+  return cache;
+}
+
+static int read_all(int fd, char *buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = read(fd, buf + done, len - done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return -1;
+    }
+    done += n;
+  }
+  return 0;
+}
+
+static int write_all(int fd, const char *buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = write(fd, buf + done, len - done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return -1;
+    }
+    done += n;
+  }
+  return 0;
+}
+
+// block_cache_get returns the html stored for key, allocated with a '\0'
+// after len bytes, or NULL on a miss
+char *block_cache_get(BlockCache *cache, const char *key, size_t key_len,
+                      size_t *len) {
+  char *path = entry_path(cache, fnv1a64(key, key_len, FNV1A64_SEED), false);
+  if (!path) {
+    return NULL;
+  }
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  free(path);
+  if (fd < 0) {
+    cache->misses++;
+    return NULL;
+  }
+
+  char *html = NULL;
+  struct stat st;
+  char *data = NULL;
+  if (fstat(fd, &st) == 0 && (data = malloc(st.st_size + 1)) != NULL &&
+      read_all(fd, data, st.st_size) == 0) {
+    data[st.st_size] = '\0';
+    size_t stored_key_len, html_len;
+    int header_len = 0;
+    if (sscanf(data, ENTRY_HEADER "%n", &stored_key_len, &html_len,
+               &header_len) == 2 &&
+        header_len > 0 &&
+        (size_t)header_len + stored_key_len + html_len == (size_t)st.st_size &&
+        stored_key_len == key_len &&
+        memcmp(data + header_len, key, key_len) == 0) {
+      html = data;
+      memmove(html, data + header_len + key_len, html_len + 1);
+      *len = html_len;
+      data = NULL;
+      // The modification time orders entries for eviction
+      futimens(fd, NULL);
+    }
+  }
+  free(data);
+  close(fd);
+
+  if (html) {
+    cache->hits++;
+  } else {
+    cache->misses++;
+  }
+  return html;
+}
+
+// block_cache_put stores html for key. The entry is written to a temporary
+// file and renamed into place, so readers see either no entry or all of it.
+// Returns 0 on success, -1 on error.
+int block_cache_put(BlockCache *cache, const char *key, size_t key_len,
+                    const char *html, size_t len) {
+  uint64_t hash = fnv1a64(key, key_len, FNV1A64_SEED);
+  char *subdir = entry_path(cache, hash, true);
+  char *path = entry_path(cache, hash, false);
+  size_t tmp_len = strlen(cache->dir) + 64;
+  char *tmp_path = malloc(tmp_len);
+  if (!subdir || !path || !tmp_path) {
+    perror("malloc failed");
+    free(subdir);
+    free(path);
+    free(tmp_path);
+    return -1;
+  }
+  snprintf(tmp_path, tmp_len, "%s/tmp-%ld-%u", cache->dir, (long)getpid(),
+           cache->tmp_count++);
+
+  int status = -1;
+  char header[64];
+  int header_len = snprintf(header, sizeof(header), ENTRY_HEADER, key_len, len);
+  if (mkdir(subdir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Failed to create cache directory %s: %s\n", subdir,
+            strerror(errno));
+  } else {
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+      fprintf(stderr, "Failed to create cache entry %s: %s\n", tmp_path,
+              strerror(errno));
+    } else {
+      bool written = write_all(fd, header, header_len) == 0 &&
+                     write_all(fd, key, key_len) == 0 &&
+                     write_all(fd, html, len) == 0;
+      if (close(fd) == 0 && written && rename(tmp_path, path) == 0) {
+        status = 0;
+        cache->stored++;
+      } else {
+        fprintf(stderr, "Failed to write cache entry %s: %s\n", path,
+                strerror(errno));
+        unlink(tmp_path);
+      }
+    }
+  }
+
+  free(subdir);
+  free(path);
+  free(tmp_path);
+  return status;
+}
+
+static int compare_entry_use(const void *a, const void *b) {
+  const struct timespec *x = &((const CacheEntry *)a)->used;
+  const struct timespec *y = &((const CacheEntry *)b)->used;
+  if (x->tv_sec != y->tv_sec) {
+    return x->tv_sec < y->tv_sec ? -1 : 1;
+  }
+  return x->tv_nsec < y->tv_nsec ? -1 : x->tv_nsec > y->tv_nsec;
+}
+
+static bool is_entry_subdir(const char *name) {
+  return strlen(name) == 2 && isxdigit((unsigned char)name[0]) &&
+         isxdigit((unsigned char)name[1]);
+}
+
+// scan_entries lists every entry of the cache with its size and last use
+static CacheEntry *scan_entries(const BlockCache *cache, size_t *count,
+                                size_t *total) {
+  DIR *top = opendir(cache->dir);
+  if (!top) {
+    fprintf(stderr, "Failed to open cache directory %s: %s\n", cache->dir,
+            strerror(errno));
+    return NULL;
+  }
+
+  size_t n = 0;
+  size_t capacity = 256;
+  CacheEntry *entries = malloc(capacity * sizeof(CacheEntry));
+  if (!entries) {
+    perror("malloc failed");
+    closedir(top);
+    return NULL;
+  }
+
+  struct dirent *sub;
+  while ((sub = readdir(top)) != NULL) {
+    if (!is_entry_subdir(sub->d_name)) {
+      continue;
+    }
+    int sub_fd = openat(dirfd(top), sub->d_name, O_RDONLY | O_DIRECTORY);
+    DIR *dir = sub_fd >= 0 ? fdopendir(sub_fd) : NULL;
+    if (!dir) {
+      if (sub_fd >= 0) {
+        close(sub_fd);
+      }
+      continue;
+    }
+
+    struct dirent *file;
+    while ((file = readdir(dir)) != NULL) {
+      struct stat st;
+      if (file->d_name[0] == '.' ||
+          fstatat(dirfd(dir), file->d_name, &st, 0) != 0 ||
+          !S_ISREG(st.st_mode)) {
+        continue;
+      }
+      if (n == capacity) {
+        capacity *= 2;
+        CacheEntry *tmp = realloc(entries, capacity * sizeof(CacheEntry));
+        if (!tmp) {
+          perror("Unable to reallocate cache entries");
+          break;
+        }
+        entries = tmp;
+      }
+      size_t len = strlen(cache->dir) + 4 + strlen(file->d_name) + 1;
+      char *path = malloc(len);
+      if (!path) {
+        perror("malloc failed");
+        break;
+      }
+      snprintf(path, len, "%s/%s/%s", cache->dir, sub->d_name, file->d_name);
+      entries[n++] =
+          (CacheEntry){.path = path, .size = st.st_size, .used = st.st_mtim};
+      *total += st.st_size;
+    }
+    closedir(dir);
+  }
+  closedir(top);
+
+  *count = n;
+  return entries;
+}
+
+// evict removes the least recently used entries once the cache is over its
+// size, down to three quarters of it so the next runs need not scan again.
+// One process evicts at a time, the others skip it.
+static void evict(const BlockCache *cache) {
+  size_t len = strlen(cache->dir) + strlen("/lock") + 1;
+  char *lock_path = malloc(len);
+  if (!lock_path) {
+    perror("malloc failed");
+    return;
+  }
+  snprintf(lock_path, len, "%s/lock", cache->dir);
+  int lock_fd = open(lock_path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  free(lock_path);
+  if (lock_fd < 0) {
+    perror("Failed to open cache lock");
+    return;
+  }
+  if (flock(lock_fd, LOCK_EX | LOCK_NB) != 0) {
+    close(lock_fd);
+    return;
+  }
+
+  size_t count = 0;
+  size_t total = 0;
+  CacheEntry *entries = scan_entries(cache, &count, &total);
+  if (entries && total > cache->max_bytes) {
+    qsort(entries, count, sizeof(CacheEntry), compare_entry_use);
+    size_t target = cache->max_bytes - cache->max_bytes / 4;
+    size_t removed = 0;
+    for (size_t i = 0; i < count && total > target; i++) {
+      if (unlink(entries[i].path) == 0) {
+        total -= entries[i].size;
+        removed++;
+      }
+    }
+    LOGF("block cache: evicted %zu of %zu entries\n", removed, count);
+  }
+  for (size_t i = 0; entries && i < count; i++) {
+    free(entries[i].path);
+  }
+  free(entries);
+  close(lock_fd);
+}
+
+void close_block_cache(BlockCache *cache) {
+  if (cache == NULL) {
+    return;
+  }
+
+  LOGF("block cache: %zu hits, %zu misses, %zu stored\n", cache->hits,
+       cache->misses, cache->stored);
+  if (cache->stored > 0) {
+    evict(cache);
+  }
+  free(cache->dir);
+  free(cache);
+}
+
+// Line breaks of the source are '\0' in the text of a block
+static bool is_label_space(char c) {
+  return c == '\0' || isspace((unsigned char)c);
+}
+
+// A reference label matches text ignoring case and with any run of
+// whitespace, line breaks included, equal to any other
+static bool label_at(const char *s, const char *end, const char *label) {
+  while (*label) {
+    if (isspace((unsigned char)*label)) {
+      if (s == end || !is_label_space(*s)) {
+        return false;
+      }
+      while (isspace((unsigned char)*label)) {
+        label++;
+      }
+      while (s < end && is_label_space(*s)) {
+        s++;
+      }
+      continue;
+    }
+    if (s == end || tolower((unsigned char)*s) != tolower((unsigned char)*label)) {
+      return false;
+    }
+    s++;
+    label++;
+  }
+  return true;
+}
+
+// mentions_label tells whether text has label right after a '[', which
+// every use of a link reference has
+static bool mentions_label(const char *text, size_t len, const char *label) {
+  const char *end = text + len;
+  for (const char *p = memchr(text, '[', len); p != NULL;
+       p = memchr(p, '[', end - p)) {
+    p++;
+    while (p < end && is_label_space(*p)) {
+      p++;
+    }
+    if (label_at(p, end, label)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// block_key identifies a block by its kind, its source lines, every link
+// reference it may use and whether code is highlighted. The other page
+// options only affect the html around the blocks, so they are not part of it.
+static char *block_key(const MDBlock *block, const char *text, size_t len,
+                       MDLinkReference *refs, size_t *key_len) {
+  int ref_count = 0;
+  for (MDLinkReference *ref = refs; ref != NULL; ref = ref->next) {
+    ref_count += mentions_label(text, len, ref->label);
+  }
+
+  char *key = NULL;
+  FILE *fp = open_memstream(&key, key_len);
+  if (!fp) {
+    perror("open_memstream failed");
+    return NULL;
+  }
+  fprintf(fp, "%d %d %d %d %d\n", block->block, block->type,
+          highlight_code_blocks, minify_html, ref_count);
+  for (MDLinkReference *ref = refs; ref != NULL && ref_count > 0;
+       ref = ref->next) {
+    if (mentions_label(text, len, ref->label)) {
+      fprintf(fp, "%s%c%s%c%c%s%c", ref->label, '\0', ref->url, '\0',
+              ref->title ? 't' : 'n', ref->title ? ref->title : "", '\0');
+    }
+  }
+  fwrite(text, 1, len, fp);
+  if (fclose(fp) != 0) {
+    perror("Failed to build cache key");
+    free(key);
+    return NULL;
+  }
+  return key;
+}
+
+// render_block writes the html of a complete top level block parsed from
+// the source lines [start, end), through the cache when it is large enough
+static void render_block(BlockCache *cache, MDSource *source,
+                         MDLinkReference *refs, MDBlock *block, int start,
+                         int end, FILE *fp) {
+  child_parsing_exec(refs, block);
+
+  // Lines are consecutive in the source buffer, '\0' ends each of them
+  const char *text = source->lines[start];
+  size_t len = 0;
+  if (end > start) {
+    const char *last = source->lines[end - 1];
+    len = last + strlen(last) - text;
+  }
+
+  size_t key_len = 0;
+  char *key = len >= BLOCK_CACHE_MIN_BYTES
+                  ? block_key(block, text, len, refs, &key_len)
+                  : NULL;
+  if (key == NULL) {
+    inline_parsing_tree(refs, block);
+    STATS_BEGIN(PHASE_RENDER);
+    print_html_block(fp, block);
+    STATS_END();
+    return;
+  }
+
+  size_t html_len = 0;
+  STATS_BEGIN(PHASE_RENDER);
+  char *html = block_cache_get(cache, key, key_len, &html_len);
+  STATS_END();
+  if (html == NULL) {
+    inline_parsing_tree(refs, block);
+    STATS_BEGIN(PHASE_RENDER);
+    FILE *block_fp = open_memstream(&html, &html_len);
+    if (!block_fp) {
+      perror("open_memstream failed");
+    } else {
+      print_html_block(block_fp, block);
+      if (fclose(block_fp) != 0) {
+        perror("Failed to render block");
+        free(html);
+        html = NULL;
+      } else {
+        block_cache_put(cache, key, key_len, html, html_len);
+      }
+    }
+    STATS_END();
+  }
+  if (html) {
+    fwrite(html, 1, html_len, fp);
+  } else {
+    print_html_block(fp, block);
+  }
+  free(html);
+  free(key);
+}
+
+// render_blocks_cached block parses source like document_block_parsing into
+// head and renders it, taking the html of large blocks from the cache. The
+// blocks found there are left without inline parsing, which must be
+// deferred. Returns NULL on error.
+RenderedBody *render_blocks_cached(BlockCache *cache, MDSource *source,
+                                   MDLinkReference *refs, MDBlock **head) {
+  RenderedBody *body = calloc(1, sizeof(RenderedBody));
+  if (body) {
+    body->chunks = calloc(1, sizeof(RenderChunk));
+  }
+  if (!body || !body->chunks) {
+    perror("calloc failed");
+    free(body);
+    return NULL;
+  }
+  body->count = 1;
+  RenderChunk *chunk = &body->chunks[0];
+  FILE *fp = open_memstream(&chunk->data, &chunk->len);
+  if (!fp) {
+    perror("open_memstream failed");
+    free_rendered_body(body);
+    return NULL;
+  }
+
+  *head = NULL;
+  PeekReader *reader = NULL;
+  if (source->line_count > 0) {
+    reader = new_peek_reader_from_source(source, DEFAULT_PEEK_COUNT);
+    if (!reader) {
+      fprintf(stderr, "Failed to create peek reader\n");
+      fclose(fp);
+      free_rendered_body(body);
+      return NULL;
+    }
+  }
+
+  TRACE_BEGIN("render_blocks_cached");
+  MDBlock *tail_block = NULL;
+  int tail_start = 0;
+  while (reader && reader->count > 0) {
+    int line = peek_reader_line_index(reader);
+    STATS_BEGIN(PHASE_BLOCK);
+    MDBlock *new_block = block_parsing(NULL, tail_block, reader, refs);
+    STATS_END();
+    if (new_block == NULL) {
+      continue;
+    }
+
+    if (tail_block == NULL) {
+      *head = new_block;
+    } else {
+      render_block(cache, source, refs, tail_block, tail_start, line, fp);
+      tail_block->next = new_block;
+    }
+    tail_block = new_block;
+    tail_start = line;
+  }
+  if (tail_block != NULL) {
+    render_block(cache, source, refs, tail_block, tail_start,
+                 source->line_count, fp);
+  }
+  free_peek_reader(reader);
+  if (trace_enabled) {
+    trace_end("render_blocks_cached", "\"hits\": %zu, \"misses\": %zu",
+              cache->hits, cache->misses);
+  }
+
+  if (fclose(fp) != 0) {
+    perror("Failed to render blocks");
+    free_rendered_body(body);
+    return NULL;
+  }
+  return body;
+}
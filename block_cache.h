@@ -0,0 +1,38 @@
+#ifndef BLOCK_CACHE_H
+#define BLOCK_CACHE_H
+
+#include <stddef.h>
+
+#include "file_reader.h"
+#include "md_parser.h"
+#include "md_regex.h"
+#include "parallel.h"
+
+// On-disk cache of rendered top level blocks, one file per block named after
+// a hash of its source lines and the link references it may use. Entries
+// are written by rename, so several processes can share a directory. The
+// least recently used entries are removed once it grows past its size.
+typedef struct BlockCache BlockCache;
+
+// Blocks with less source text than this are cheaper to render than to look
+// up
+#ifndef BLOCK_CACHE_MIN_BYTES
+#define BLOCK_CACHE_MIN_BYTES 512
+#endif
+
+#ifndef BLOCK_CACHE_DEFAULT_MB
+#define BLOCK_CACHE_DEFAULT_MB 64
+#endif
+
+BlockCache *open_block_cache(const char *dir, size_t max_bytes);
+void close_block_cache(BlockCache *cache);
+
+char *block_cache_get(BlockCache *cache, const char *key, size_t key_len,
+                      size_t *len);
+int block_cache_put(BlockCache *cache, const char *key, size_t key_len,
+                    const char *html, size_t len);
+
+RenderedBody *render_blocks_cached(BlockCache *cache, MDSource *source,
+                                   MDLinkReference *refs, MDBlock **head);
+
+#endif
@@ -0,0 +1,321 @@
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "events.h"
+#include "file_reader.h"
+#include "html_writer.h"
+#include "md_regex.h"
+
+// Lines read from the file that blocks still point into. Once a top level
+// block is released, the lines before the next one are freed, so only the
+// open block and the peek window are kept.
+typedef struct {
+  FILE *fp;
+  char **lines;
+  size_t count;
+  size_t capacity;
+  size_t base; // line number of lines[0]
+  size_t pulled; // lines read so far
+} LineStream;
+
+static char *next_stream_line(void *ctx) {
+  LineStream *stream = ctx;
+  if (stream->count == stream->capacity) {
+    size_t capacity = stream->capacity ? stream->capacity * 2 : 64;
+    char **lines = realloc(stream->lines, capacity * sizeof(char *));
+    if (!lines) {
+      perror("Unable to reallocate stream lines");
+      return NULL;
+    }
+    stream->lines = lines;
+    stream->capacity = capacity;
+  }
+
+  char *line = read_line(stream->fp, true);
+  if (line) {
+    stream->lines[stream->count++] = line;
+    stream->pulled++;
+  }
+  return line;
+}
+
+static void release_lines_before(LineStream *stream, size_t line) {
+  size_t n = line > stream->base ? line - stream->base : 0;
+  if (n > stream->count) {
+    n = stream->count;
+  }
+  for (size_t i = 0; i < n; i++) {
+    free(stream->lines[i]);
+  }
+  memmove(stream->lines, stream->lines + n,
+          (stream->count - n) * sizeof(char *));
+  stream->count -= n;
+  stream->base += n;
+}
+
+// A pass over the file for the link references, which may be defined after
+// their use, then the file is rewound
+static MDLinkReference *stream_link_references(FILE *fp) {
+  MDLinkReference *head = NULL;
+  char *line;
+  while ((line = read_line(fp, true)) != NULL) {
+    MDLinkReference *ref = parse_markdown_links_reference(line);
+    if (ref != NULL) {
+      ref->next = head;
+      head = ref;
+    }
+    free(line);
+  }
+  return head;
+}
+
+static void emit_text(const MDEventHandler *h, const char *text, size_t len) {
+  if (len > 0 && h->text) {
+    h->text(h->ctx, text, len);
+  }
+}
+
+// attribute_value returns a copy of the value of name="..." in the tag from
+// p to end, or NULL
+static char *attribute_value(const char *p, const char *end, const char *name) {
+  size_t name_len = strlen(name);
+  for (; p + name_len + 2 < end; p++) {
+    if (strncmp(p, name, name_len) == 0 && p[name_len] == '=' &&
+        p[name_len + 1] == '"' && isspace((unsigned char)p[-1])) {
+      const char *value = p + name_len + 2;
+      const char *close = memchr(value, '"', end - value);
+      return close ? strndup(value, close - value) : NULL;
+    }
+  }
+  return NULL;
+}
+
+static void emit_link(const MDEventHandler *h, const char *tag,
+                      const char *end) {
+  if (!h->enter_link) {
+    return;
+  }
+  char *url = attribute_value(tag, end, "href");
+  char *title = attribute_value(tag, end, "title");
+  h->enter_link(h->ctx, url ? url : "", title);
+  free(url);
+  free(title);
+}
+
+static void emit_image(const MDEventHandler *h, const char *tag,
+                       const char *end) {
+  if (!h->image) {
+    return;
+  }
+  char *src = attribute_value(tag, end, "src");
+  char *alt = attribute_value(tag, end, "alt");
+  char *title = attribute_value(tag, end, "title");
+  h->image(h->ctx, src ? src : "", alt ? alt : "", title);
+  free(src);
+  free(alt);
+  free(title);
+}
+
+// emit_literal emits the text from p to end, dropping backslash escapes the
+// way html_write_escaped drops them
+static void emit_literal(const MDEventHandler *h, const char *p,
+                         const char *end) {
+  const char *run = p;
+  for (; p < end; p++) {
+    if (*p == '\\' && p + 1 < end && strchr(MD_ESCAPABLE_CHARS, p[1])) {
+      emit_text(h, run, p - run);
+      run = ++p;
+    }
+  }
+  emit_text(h, run, end - run);
+}
+
+// emit_inline turns inline parsed content into text, link and image events.
+// Tags are taken out the way a browser would show them, except in code spans
+// whose content is kept as literal text, tag-like or not.
+static void emit_inline(const MDEventHandler *h, const char *content) {
+  const char *run = content;
+  const char *p = content;
+  while (*p) {
+    if (*p == '\\' && p[1] != '\0' && strchr(MD_ESCAPABLE_CHARS, p[1])) {
+      p += 2;
+      continue;
+    }
+
+    const char *end;
+    if (*p != '<' ||
+        !(isalpha((unsigned char)p[1]) || p[1] == '/' || p[1] == '!') ||
+        (end = strchr(p, '>')) == NULL) {
+      p++;
+      continue;
+    }
+    emit_literal(h, run, p);
+    if (strncmp(p, "<code>", 6) == 0) {
+      const char *code = p + 6;
+      const char *close = strstr(code, "</code>");
+      if (close == NULL) {
+        close = code + strlen(code);
+        end = close - 1;
+      } else {
+        end = close + 6;
+      }
+      emit_literal(h, code, close);
+    } else if (strncmp(p, "<a ", 3) == 0) {
+      emit_link(h, p, end);
+    } else if (strncmp(p, "</a>", 4) == 0) {
+      if (h->leave_link) {
+        h->leave_link(h->ctx);
+      }
+    } else if (strncmp(p, "<img ", 5) == 0) {
+      emit_image(h, p, end);
+    } else if (strncmp(p, "<br", 3) == 0) {
+      emit_text(h, "\n", 1);
+    }
+    p = end + 1;
+    run = p;
+  }
+  emit_literal(h, run, p);
+}
+
+static void emit_block(const MDEventHandler *h, const MDBlock *block) {
+  for (; block != NULL; block = block->next) {
+    if (block->block == SECTION_BREAK || block->block == LINK_REFERENCE) {
+      continue;
+    }
+
+    if (h->enter_block) {
+      h->enter_block(h->ctx, block);
+    }
+    if (block->child != NULL) {
+      emit_block(h, block->child);
+    } else if (block->block == CODEBLOCK) {
+      for (int i = 0; block->lines && i < block->lines->count; i++) {
+        if (i > 0) {
+          emit_text(h, "\n", 1);
+        }
+        emit_text(h, block->lines->lines[i], strlen(block->lines->lines[i]));
+      }
+    } else if (block->block != HTML_TAG && block->content != NULL) {
+      emit_inline(h, block->content);
+    }
+    if (h->leave_block) {
+      h->leave_block(h->ctx, block);
+    }
+  }
+}
+
+// emit_top_block completes a top level block, reports it and frees it
+static void emit_top_block(const MDEventHandler *h, MDLinkReference *refs,
+                           MDBlock *block) {
+  child_parsing_exec(refs, block);
+  inline_parsing(refs, block);
+  emit_block(h, block);
+  free_mdblocks(block);
+}
+
+// parse_events parses the markdown file fp and reports its blocks to handler
+// as each of them closes, without keeping the document. The file is read
+// twice, the first pass collects the link references, so it must be
+// seekable. Returns 0 on success, -1 on error.
+int parse_events(FILE *fp, const MDEventHandler *handler) {
+  MDLinkReference *refs = stream_link_references(fp);
+  if (fseek(fp, 0, SEEK_SET) != 0) {
+    perror("Failed to rewind markdown file");
+    free_md_link_reference(refs);
+    return -1;
+  }
+
+  LineStream stream = {.fp = fp};
+  PeekReader *reader = new_peek_reader_from_callback(next_stream_line, &stream,
+                                                     DEFAULT_PEEK_COUNT);
+  if (!reader) {
+    fprintf(stderr, "Failed to create peek reader\n");
+    free_md_link_reference(refs);
+    return -1;
+  }
+
+  MDBlock *tail_block = NULL;
+  while (reader->count > 0) {
+    size_t line = stream.pulled - reader->count;
+    MDBlock *new_block = block_parsing(NULL, tail_block, reader, refs);
+    if (new_block == NULL) {
+      continue;
+    }
+    if (tail_block != NULL) {
+      emit_top_block(handler, refs, tail_block);
+      release_lines_before(&stream, line);
+    }
+    tail_block = new_block;
+  }
+  if (tail_block != NULL) {
+    emit_top_block(handler, refs, tail_block);
+  }
+
+  free_peek_reader(reader);
+  release_lines_before(&stream, stream.base + stream.count);
+  free(stream.lines);
+  free_md_link_reference(refs);
+  return 0;
+}
+
+// Events written one per line by print_events
+static void write_event_text(FILE *out, const char *text, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (text[i] == '\n') {
+      fputs("\\n", out);
+    } else if (text[i] == '\\') {
+      fputs("\\\\", out);
+    } else {
+      fputc(text[i], out);
+    }
+  }
+}
+
+static void print_enter_block(void *ctx, const MDBlock *block) {
+  fprintf(ctx, "enter %s\n", blocktag_to_string(block->block));
+}
+
+static void print_leave_block(void *ctx, const MDBlock *block) {
+  fprintf(ctx, "leave %s\n", blocktag_to_string(block->block));
+}
+
+static void print_text(void *ctx, const char *text, size_t len) {
+  fputs("text ", ctx);
+  write_event_text(ctx, text, len);
+  fputc('\n', ctx);
+}
+
+static void print_enter_link(void *ctx, const char *url, const char *title) {
+  fprintf(ctx, "enter link %s", url);
+  if (title) {
+    fprintf(ctx, " \"%s\"", title);
+  }
+  fputc('\n', ctx);
+}
+
+static void print_leave_link(void *ctx) { fputs("leave link\n", ctx); }
+
+static void print_image(void *ctx, const char *src, const char *alt,
+                        const char *title) {
+  fprintf(ctx, "image %s \"%s\"", src, alt);
+  if (title) {
+    fprintf(ctx, " \"%s\"", title);
+  }
+  fputc('\n', ctx);
+}
+
+// print_events writes the events of the markdown file fp to out as text,
+// one per line
+int print_events(FILE *out, FILE *fp) {
+  MDEventHandler handler = {.ctx = out,
+                            .enter_block = print_enter_block,
+                            .leave_block = print_leave_block,
+                            .text = print_text,
+                            .enter_link = print_enter_link,
+                            .leave_link = print_leave_link,
+                            .image = print_image};
+  return parse_events(fp, &handler);
+}
@@ -0,0 +1,29 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdio.h>
+
+#include "md_parser.h"
+
+// Callbacks of parse_events, any of them may be NULL. Blocks and strings are
+// only valid during the call.
+typedef struct {
+  void *ctx;
+  // Every block, nested ones included, except section breaks and link
+  // reference definitions
+  void (*enter_block)(void *ctx, const MDBlock *block);
+  void (*leave_block)(void *ctx, const MDBlock *block);
+  // Text of headings, paragraphs, list items and code blocks with the inline
+  // markup taken out. Not '\0' terminated.
+  void (*text)(void *ctx, const char *text, size_t len);
+  // Around the text of a link, title is NULL without one
+  void (*enter_link)(void *ctx, const char *url, const char *title);
+  void (*leave_link)(void *ctx);
+  void (*image)(void *ctx, const char *src, const char *alt,
+                const char *title);
+} MDEventHandler;
+
+int parse_events(FILE *fp, const MDEventHandler *handler);
+int print_events(FILE *out, FILE *fp);
+
+#endif
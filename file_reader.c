@@ -143,6 +143,94 @@ char *ltrim_space(char *str) {
   return trimmed_str;
 }
 
+MDSource *new_md_source(FILE *fp) {
+  size_t capacity = BUFFER_CHUNK_SIZE;
+  size_t size = 0;
+  char *buffer = malloc(capacity);
+  if (!buffer) {
+    perror("malloc failed");
+    return NULL;
+  }
+
+  size_t n;
+  while ((n = fread(buffer + size, 1, capacity - size - 1, fp)) > 0) {
+    size += n;
+    if (capacity - size - 1 == 0) {
+      capacity *= 2;
+      char *tmp_buffer = realloc(buffer, capacity);
+      if (!tmp_buffer) {
+        perror("Unable to reallocate buffer");
+        free(buffer);
+        return NULL;
+      }
+      buffer = tmp_buffer;
+    }
+  }
+  buffer[size] = '\0';
+
+  return new_md_source_from_buffer(buffer, size);
+}
+
+// new_md_source_from_buffer splits size bytes of buffer into lines, the
+// buffer is taken over and must hold a '\0' after them. It is freed on error.
+MDSource *new_md_source_from_buffer(char *buffer, size_t size) {
+  MDSource *source = malloc(sizeof(MDSource));
+  if (!source) {
+    perror("malloc failed");
+    free(buffer);
+    return NULL;
+  }
+
+  // A trailing newline does not start another line, same as read_line
+  int line_count = 0;
+  for (const char *p = buffer; p < buffer + size;) {
+    const char *end = memchr(p, '\n', buffer + size - p);
+    line_count++;
+    if (end == NULL) {
+      break;
+    }
+    p = end + 1;
+  }
+
+  char **lines = malloc((line_count > 0 ? line_count : 1) * sizeof(char *));
+  if (!lines) {
+    perror("malloc failed");
+    free(buffer);
+    free(source);
+    return NULL;
+  }
+
+  int idx = 0;
+  for (char *p = buffer; p < buffer + size;) {
+    char *end = memchr(p, '\n', buffer + size - p);
+    lines[idx++] = p;
+    if (end == NULL) {
+      break;
+    }
+    *end = '\0';
+    p = end + 1;
+  }
+
+  source->buffer = buffer;
+  source->size = size;
+  source->lines = lines;
+  source->line_count = line_count;
+  source->reference_lines = NULL;
+
+  return source;
+}
+
+void free_md_source(MDSource *source) {
+  if (!source) {
+    return;
+  }
+
+  free(source->lines);
+  free(source->buffer);
+  free(source->reference_lines);
+  free(source);
+}
+
 PeekReader *new_peek_reader_from_file(FILE *fp, int peek_count) {
   if (peek_count > MAX_PEEK) {
     return NULL;
@@ -186,6 +274,8 @@ PeekReader *new_peek_reader_from_lines(char **lines, int total_lines,
   reader->source.str_array.lines = lines;
   reader->source.str_array.total_lines = total_lines;
   reader->source.str_array.line_idx = 0;
+  reader->source.str_array.owns_lines = true;
+  reader->source.str_array.reference_lines = NULL;
   reader->current = 0;
   reader->count = 0;
   reader->total = peek_count + 1;
@@ -204,6 +294,74 @@ PeekReader *new_peek_reader_from_lines(char **lines, int total_lines,
   return reader;
 }
 
+PeekReader *new_peek_reader_from_line_views(char **lines, int total_lines,
+                                            int peek_count) {
+  PeekReader *reader = new_peek_reader_from_lines(lines, total_lines, peek_count);
+  if (reader) {
+    reader->source.str_array.owns_lines = false;
+  }
+  return reader;
+}
+
+PeekReader *new_peek_reader_from_source(MDSource *source, int peek_count) {
+  return new_peek_reader_from_source_range(source, 0, peek_count);
+}
+
+PeekReader *new_peek_reader_from_source_range(MDSource *source, int start,
+                                              int peek_count) {
+  if (!source) {
+    return NULL;
+  }
+  PeekReader *reader = new_peek_reader_from_line_views(
+      source->lines + start, source->line_count - start, peek_count);
+  if (reader && source->reference_lines) {
+    reader->source.str_array.reference_lines = source->reference_lines + start;
+  }
+  return reader;
+}
+
+static char *next_callback_line(PeekReader *reader) {
+  if (reader->source.callback.ended) {
+    return NULL;
+  }
+  char *line = reader->source.callback.next_line(reader->source.callback.ctx);
+  if (!line) {
+    reader->source.callback.ended = true;
+  }
+  return line;
+}
+
+// new_peek_reader_from_callback pulls lines from next_line as the reader
+// advances, so they may still be produced while the reader is in use
+PeekReader *new_peek_reader_from_callback(PeekLineSource next_line, void *ctx,
+                                          int peek_count) {
+  if (peek_count > MAX_PEEK) {
+    return NULL;
+  }
+
+  PeekReader *reader = malloc(sizeof(PeekReader));
+  if (!reader) {
+    return NULL;
+  }
+
+  reader->source_type = PEEK_SOURCE_CALLBACK;
+  reader->source.callback.next_line = next_line;
+  reader->source.callback.ctx = ctx;
+  reader->source.callback.ended = false;
+  reader->current = 0;
+  reader->count = 0;
+  reader->total = peek_count + 1;
+
+  for (int i = 0; i < reader->total; i++) {
+    reader->buffer[i] = next_callback_line(reader);
+    if (reader->buffer[i]) {
+      reader->count++;
+    }
+  }
+
+  return reader;
+}
+
 char *peek_reader_current(PeekReader *reader) {
   return reader->buffer[reader->current];
 }
@@ -243,11 +401,32 @@ int peek_reader_advance(PeekReader *reader) {
       reader->buffer[refill_idx] = NULL; // No more lines to read
       reader->count--;
     }
+  } else if (reader->source_type == PEEK_SOURCE_CALLBACK) {
+    reader->buffer[refill_idx] = next_callback_line(reader);
+    if (!reader->buffer[refill_idx]) {
+      reader->count--;
+    }
   }
 
   return reader->count > 0;
 }
 
+int peek_reader_line_index(PeekReader *reader) {
+  if (reader->source_type != PEEK_SOURCE_STRING_ARRAY) {
+    return -1;
+  }
+  return reader->source.str_array.line_idx - reader->count;
+}
+
+int peek_reader_reference_line(PeekReader *reader) {
+  if (reader->source_type != PEEK_SOURCE_STRING_ARRAY ||
+      reader->source.str_array.reference_lines == NULL || reader->count == 0) {
+    return -1;
+  }
+  return reader->source.str_array
+      .reference_lines[peek_reader_line_index(reader)];
+}
+
 void free_peek_reader(PeekReader *reader) {
   if (!reader) {
     return;
@@ -257,7 +436,8 @@ void free_peek_reader(PeekReader *reader) {
     for (int i = 0; i < reader->total; i++) {
       free(reader->buffer[i]);
     }
-  } else if (reader->source_type == PEEK_SOURCE_STRING_ARRAY) {
+  } else if (reader->source_type == PEEK_SOURCE_STRING_ARRAY &&
+             reader->source.str_array.owns_lines) {
     for (int i = 0; i < reader->source.str_array.total_lines; i++) {
       free(reader->source.str_array.lines[i]);
     }
@@ -11,14 +11,32 @@ char *read_line(FILE *file, bool remove_newline);
 char **content_splitter(const char *content, char splitter, int *split_count);
 char *ltrim_space(char *str);
 
+// Whole markdown input kept in memory. Line breaks in buffer are replaced by
+// '\0' so every entry of lines is a C string pointing into buffer.
+typedef struct {
+  char *buffer;
+  size_t size;
+  char **lines;
+  int line_count;
+  bool *reference_lines; // definition lines found by the reference pass
+} MDSource;
+
+MDSource *new_md_source(FILE *fp);
+MDSource *new_md_source_from_buffer(char *buffer, size_t size);
+void free_md_source(MDSource *source);
+
 #define DEFAULT_PEEK_COUNT 5
 #define MAX_PEEK 10
 
 typedef enum {
   PEEK_SOURCE_FILE,
   PEEK_SOURCE_STRING_ARRAY,
+  PEEK_SOURCE_CALLBACK,
 } PeekSourceType;
 
+// Returns the next line, borrowed from the callback, or NULL at the end
+typedef char *(*PeekLineSource)(void *ctx);
+
 // Using a circular buffer to store each peek lines
 typedef struct {
   PeekSourceType source_type;
@@ -28,7 +46,14 @@ typedef struct {
       char **lines;
       int total_lines;
       int line_idx; // index into string array source type
+      bool owns_lines; // lines are freed with the reader
+      const bool *reference_lines; // optional, parallel to lines
     } str_array;
+    struct {
+      PeekLineSource next_line;
+      void *ctx;
+      bool ended; // next_line is not called again once it returned NULL
+    } callback;
   } source;
 
   char *buffer[MAX_PEEK + 1]; // circular buffer
@@ -40,12 +65,26 @@ typedef struct {
 PeekReader *new_peek_reader_from_file(FILE *fp, int peek_count);
 PeekReader *new_peek_reader_from_lines(char **lines, int total_lines,
                                      int peek_count);
+// Same as new_peek_reader_from_lines, but lines are borrowed from the caller
+PeekReader *new_peek_reader_from_line_views(char **lines, int total_lines,
+                                          int peek_count);
+PeekReader *new_peek_reader_from_source(MDSource *source, int peek_count);
+// Reader over the source lines from line start on
+PeekReader *new_peek_reader_from_source_range(MDSource *source, int start,
+                                              int peek_count);
+PeekReader *new_peek_reader_from_callback(PeekLineSource next_line, void *ctx,
+                                          int peek_count);
 // Get current line
 char *peek_reader_current(PeekReader *reader);
 // Gets the i-th line ahead
 char *peek_reader_peek(PeekReader *reader, int i);
 // Advances to next line, returns 1 if successful, 0 on EOF
 int peek_reader_advance(PeekReader *reader);
+// Index of the current line in a string array source, -1 for other sources
+int peek_reader_line_index(PeekReader *reader);
+// Whether the current line is a link reference definition: 1 or 0 when known
+// from the reference pass, -1 when the line has to be parsed
+int peek_reader_reference_line(PeekReader *reader);
 void free_peek_reader(PeekReader *reader);
 
 #endif
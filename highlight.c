@@ -0,0 +1,667 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "highlight.h"
+
+// Code blocks carry no language, it is guessed from hints scored over the
+// lines. Below this score the block is left plain.
+#define MIN_LANGUAGE_SCORE 3
+
+typedef enum {
+  HINT_ANYWHERE,
+  HINT_START, // at the start of the line, after its indentation
+  HINT_END,   // at the end of the line, before trailing spaces
+  HINT_KEY,   // the line is a "key:" or "key: value" mapping entry
+} HintKind;
+
+typedef struct {
+  HintKind kind;
+  const char *text;
+  int weight;
+} Hint;
+
+// A language is a set of tables driving the same lexer. Class names are the
+// highlight.js ones, which the theme already styles.
+typedef struct {
+  const char *name;
+  const char *const *keywords;
+  const char *const *types;
+  const char *const *literals;
+  const char *const *built_ins;
+  // Keywords naming the identifier following them, "class" ones a type
+  const char *const *title_keywords;
+  const char *line_comment;
+  const char *block_comment_open;
+  const char *block_comment_close;
+  const char *quotes;
+  // Quotes of strings that may run over several lines
+  const char *multiline_quotes;
+  const char *word_chars; // besides letters, digits and '_'
+  bool triple_quotes;
+  bool string_prefixes; // r"", b"", f""
+  bool preprocessor; // '#' lines
+  bool decorators; // '@name' lines
+  bool variables; // $NAME, ${NAME}, $1
+  bool quoted_keys; // "key": ...
+  bool bare_keys; // key: ...
+  bool c_declarations; // "type name(" names a function
+  const Hint *hints;
+} Language;
+
+static const char *const c_keywords[] = {
+    "auto", "break", "case", "catch", "class", "const", "constexpr", "continue",
+    "default", "delete", "do", "else", "enum", "explicit", "extern", "for",
+    "friend", "goto", "if", "inline", "namespace", "new", "noexcept",
+    "operator", "private", "protected", "public", "register", "return",
+    "sizeof", "static", "static_assert", "static_cast", "struct", "switch",
+    "template", "this", "throw", "try", "typedef", "typename", "union", "using",
+    "virtual", "volatile", "while", NULL};
+static const char *const c_types[] = {
+    "bool", "char", "double", "float", "int", "long", "short", "signed",
+    "unsigned", "void", "size_t", "ssize_t", "int8_t", "int16_t", "int32_t",
+    "int64_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t", "FILE", "string",
+    "vector", NULL};
+static const char *const c_literals[] = {
+    "true", "false", "NULL", "nullptr", NULL};
+static const char *const c_built_ins[] = {
+    "printf", "fprintf", "sprintf", "snprintf", "malloc", "calloc", "realloc",
+    "free", "memcpy", "memset", "strlen", "strcmp", "fopen", "fclose", "puts",
+    "std", "cout", "cin", "endl", NULL};
+static const Hint c_hints[] = {
+    {HINT_START, "#include", 5}, {HINT_START, "#define", 4},
+    {HINT_ANYWHERE, "std::", 3}, {HINT_ANYWHERE, "int main(", 4},
+    {HINT_ANYWHERE, "printf(", 2}, {HINT_ANYWHERE, "malloc(", 3},
+    {HINT_ANYWHERE, "sizeof(", 2}, {HINT_ANYWHERE, "NULL", 2},
+    {HINT_ANYWHERE, "->", 1}, {HINT_START, "void ", 2},
+    {HINT_START, "int ", 2}, {HINT_START, "char ", 2},
+    {HINT_START, "struct ", 2}, {HINT_END, ";", 1},
+    {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const go_keywords[] = {
+    "break", "case", "chan", "const", "continue", "default", "defer", "else",
+    "fallthrough", "for", "func", "go", "goto", "if", "import", "interface",
+    "map", "package", "range", "return", "select", "struct", "switch", "type",
+    "var", NULL};
+static const char *const go_types[] = {
+    "bool", "byte", "complex64", "complex128", "error", "float32", "float64",
+    "int", "int8", "int16", "int32", "int64", "rune", "string", "uint", "uint8",
+    "uint16", "uint32", "uint64", "uintptr", "any", NULL};
+static const char *const go_literals[] = {"true", "false", "nil", "iota", NULL};
+static const char *const go_built_ins[] = {
+    "append", "cap", "close", "copy", "delete", "len", "make", "new", "panic",
+    "print", "println", "recover", NULL};
+static const char *const go_title_keywords[] = {"func", "type", NULL};
+static const Hint go_hints[] = {
+    {HINT_START, "package ", 5}, {HINT_START, "func ", 4},
+    {HINT_ANYWHERE, ":=", 3}, {HINT_ANYWHERE, "fmt.", 4},
+    {HINT_START, "import (", 4}, {HINT_ANYWHERE, "err != nil", 4},
+    {HINT_ANYWHERE, "chan ", 2}, {HINT_ANYWHERE, "go func", 3},
+    {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const python_keywords[] = {
+    "and", "as", "assert", "async", "await", "break", "class", "continue",
+    "def", "del", "elif", "else", "except", "finally", "for", "from", "global",
+    "if", "import", "in", "is", "lambda", "nonlocal", "not", "or", "pass",
+    "raise", "return", "try", "while", "with", "yield", NULL};
+static const char *const python_literals[] = {"True", "False", "None", NULL};
+static const char *const python_built_ins[] = {
+    "print", "len", "range", "open", "str", "int", "float", "list", "dict",
+    "set", "tuple", "enumerate", "zip", "isinstance", "super", "self", "map",
+    "filter", "sorted", NULL};
+static const char *const python_title_keywords[] = {"def", "class", NULL};
+static const Hint python_hints[] = {
+    {HINT_START, "def ", 4}, {HINT_START, "from ", 2},
+    {HINT_ANYWHERE, "self.", 3}, {HINT_START, "elif ", 4},
+    {HINT_ANYWHERE, "__init__", 4}, {HINT_ANYWHERE, "None", 2},
+    {HINT_ANYWHERE, "print(", 1}, {HINT_ANYWHERE, "\"\"\"", 2},
+    {HINT_START, "import ", 1}, {HINT_END, ":", 1},
+    {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const js_keywords[] = {
+    "async", "await", "break", "case", "catch", "class", "const", "continue",
+    "debugger", "default", "delete", "do", "else", "export", "extends",
+    "finally", "for", "from", "function", "if", "import", "in", "instanceof",
+    "let", "new", "of", "return", "static", "super", "switch", "this", "throw",
+    "try", "typeof", "var", "void", "while", "yield", NULL};
+static const char *const js_literals[] = {
+    "true", "false", "null", "undefined", "NaN", "Infinity", NULL};
+static const char *const js_built_ins[] = {
+    "console", "document", "window", "Math", "JSON", "Object", "Array",
+    "String", "Number", "Promise", "require", "module", "process", "setTimeout",
+    NULL};
+static const char *const js_title_keywords[] = {"function", "class", NULL};
+static const Hint js_hints[] = {
+    {HINT_START, "function ", 3}, {HINT_ANYWHERE, "const ", 2},
+    {HINT_ANYWHERE, "let ", 2}, {HINT_ANYWHERE, "=>", 2},
+    {HINT_ANYWHERE, "console.", 4}, {HINT_ANYWHERE, "===", 3},
+    {HINT_ANYWHERE, "require(", 3}, {HINT_ANYWHERE, "document.", 3},
+    {HINT_ANYWHERE, "undefined", 3}, {HINT_START, "export ", 2},
+    {HINT_END, ";", 1}, {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const shell_keywords[] = {
+    "if", "then", "else", "elif", "fi", "for", "while", "until", "do", "done",
+    "case", "esac", "in", "function", "select", "return", "local", "export",
+    "readonly", NULL};
+static const char *const shell_literals[] = {"true", "false", NULL};
+static const char *const shell_built_ins[] = {
+    "echo", "cd", "pwd", "ls", "cat", "grep", "sed", "awk", "cp", "mv", "rm",
+    "mkdir", "chmod", "chown", "source", "exit", "set", "unset", "read",
+    "printf", "test", "sudo", "make", "git", "curl", "wget", "tar", "apt",
+    "apt-get", "dnf", "pacman", "pip", "npm", NULL};
+static const Hint shell_hints[] = {
+    {HINT_START, "$ ", 5}, {HINT_START, "#!/bin/", 5},
+    {HINT_START, "#!/usr/bin/env", 5}, {HINT_START, "sudo ", 4},
+    {HINT_START, "echo ", 2}, {HINT_START, "cd ", 3},
+    {HINT_START, "make", 2}, {HINT_START, "apt", 3},
+    {HINT_START, "git ", 3}, {HINT_START, "./", 3},
+    {HINT_START, "mkdir ", 3}, {HINT_START, "if [", 3},
+    {HINT_ANYWHERE, "$(", 2}, {HINT_ANYWHERE, " | ", 1},
+    {HINT_ANYWHERE, " && ", 1}, {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const json_literals[] = {"true", "false", "null", NULL};
+static const Hint json_hints[] = {
+    {HINT_START, "\"", 1}, {HINT_ANYWHERE, "\": ", 2},
+    {HINT_START, "{", 1}, {HINT_START, "}", 1},
+    {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const yaml_literals[] = {
+    "true", "false", "null", "yes", "no", NULL};
+static const Hint yaml_hints[] = {
+    {HINT_START, "---", 3}, {HINT_KEY, NULL, 2},
+    {HINT_START, "- ", 1}, {HINT_ANYWHERE, NULL, 0}};
+
+static const char *const no_words[] = {NULL};
+
+// In order of preference when scores are equal
+static const Language languages[] = {
+    {.name = "c",
+     .keywords = c_keywords,
+     .types = c_types,
+     .literals = c_literals,
+     .built_ins = c_built_ins,
+     .title_keywords = no_words,
+     .line_comment = "//",
+     .block_comment_open = "/*",
+     .block_comment_close = "*/",
+     .quotes = "\"'",
+     .multiline_quotes = "",
+     .word_chars = "",
+     .preprocessor = true,
+     .c_declarations = true,
+     .hints = c_hints},
+    {.name = "go",
+     .keywords = go_keywords,
+     .types = go_types,
+     .literals = go_literals,
+     .built_ins = go_built_ins,
+     .title_keywords = go_title_keywords,
+     .line_comment = "//",
+     .block_comment_open = "/*",
+     .block_comment_close = "*/",
+     .quotes = "\"'`",
+     .multiline_quotes = "`",
+     .word_chars = "",
+     .hints = go_hints},
+    {.name = "python",
+     .keywords = python_keywords,
+     .types = no_words,
+     .literals = python_literals,
+     .built_ins = python_built_ins,
+     .title_keywords = python_title_keywords,
+     .line_comment = "#",
+     .quotes = "\"'",
+     .multiline_quotes = "",
+     .word_chars = "",
+     .triple_quotes = true,
+     .string_prefixes = true,
+     .decorators = true,
+     .hints = python_hints},
+    {.name = "javascript",
+     .keywords = js_keywords,
+     .types = no_words,
+     .literals = js_literals,
+     .built_ins = js_built_ins,
+     .title_keywords = js_title_keywords,
+     .line_comment = "//",
+     .block_comment_open = "/*",
+     .block_comment_close = "*/",
+     .quotes = "\"'`",
+     .multiline_quotes = "`",
+     .word_chars = "$",
+     .hints = js_hints},
+    {.name = "bash",
+     .keywords = shell_keywords,
+     .types = no_words,
+     .literals = shell_literals,
+     .built_ins = shell_built_ins,
+     .title_keywords = no_words,
+     .line_comment = "#",
+     .quotes = "\"'",
+     .multiline_quotes = "",
+     .word_chars = "-",
+     .variables = true,
+     .hints = shell_hints},
+    {.name = "json",
+     .keywords = no_words,
+     .types = no_words,
+     .literals = json_literals,
+     .built_ins = no_words,
+     .title_keywords = no_words,
+     .quotes = "\"",
+     .multiline_quotes = "",
+     .word_chars = "",
+     .quoted_keys = true,
+     .hints = json_hints},
+    {.name = "yaml",
+     .keywords = no_words,
+     .types = no_words,
+     .literals = yaml_literals,
+     .built_ins = no_words,
+     .title_keywords = no_words,
+     .line_comment = "#",
+     .quotes = "\"'",
+     .multiline_quotes = "",
+     .word_chars = "",
+     .quoted_keys = true,
+     .bare_keys = true,
+     .hints = yaml_hints},
+};
+
+#define LANGUAGE_COUNT (sizeof(languages) / sizeof(languages[0]))
+
+typedef enum {
+  TOKEN_NONE,
+  TOKEN_TYPE,
+  TOKEN_WORD,
+  TOKEN_OTHER,
+} TokenKind;
+
+typedef struct {
+  FILE *fp;
+  const Language *lang;
+  // Class and closing delimiter of a comment or string left open at the end
+  // of the previous line
+  const char *open_class;
+  const char *close;
+  bool close_escapes;
+  const char *title_class; // set after a title keyword
+  TokenKind prev;
+} Lexer;
+
+static bool is_word_char(const Language *lang, char c) {
+  return isalnum((unsigned char)c) || c == '_' ||
+         (c != '\0' && strchr(lang->word_chars, c) != NULL);
+}
+
+static bool in_words(const char *const *words, const char *word, size_t len) {
+  for (; *words != NULL; words++) {
+    if (strncmp(*words, word, len) == 0 && (*words)[len] == '\0') {
+      return true;
+    }
+  }
+  return false;
+}
+
+// key_length returns the length of the "key" of a "key:" or "key: value"
+// line starting at p, or 0
+static size_t key_length(const char *p) {
+  size_t len = strcspn(p, ":#\"'{}[],");
+  if (len == 0 || p[len] != ':' ||
+      (p[len + 1] != '\0' && !isspace((unsigned char)p[len + 1]))) {
+    return 0;
+  }
+  return len;
+}
+
+// key_start skips the indentation and the list marker of a yaml line
+static const char *key_start(const char *line) {
+  const char *p = line + strspn(line, " \t");
+  if (p[0] == '-' && p[1] == ' ') {
+    p += 2 + strspn(p + 2, " \t");
+  }
+  return p;
+}
+
+static bool hint_matches(const Hint *hint, const char *line) {
+  const char *start = line + strspn(line, " \t");
+  size_t len;
+  switch (hint->kind) {
+  case HINT_START:
+    return strncmp(start, hint->text, strlen(hint->text)) == 0;
+  case HINT_END:
+    len = strlen(start);
+    while (len > 0 && isspace((unsigned char)start[len - 1])) {
+      len--;
+    }
+    return len >= strlen(hint->text) &&
+           strncmp(start + len - strlen(hint->text), hint->text,
+                   strlen(hint->text)) == 0;
+  case HINT_KEY:
+    return key_length(key_start(line)) > 0;
+  case HINT_ANYWHERE:
+  default:
+    return strstr(line, hint->text) != NULL;
+  }
+}
+
+// detect_language scores every language by the hints found on each line
+static const Language *detect_language(const LineList *lines) {
+  const Language *best = NULL;
+  int best_score = MIN_LANGUAGE_SCORE - 1;
+  for (size_t i = 0; i < LANGUAGE_COUNT; i++) {
+    int score = 0;
+    for (int j = 0; j < lines->count; j++) {
+      for (const Hint *hint = languages[i].hints;
+           hint->weight > 0; hint++) {
+        if (hint_matches(hint, lines->lines[j])) {
+          score += hint->weight;
+        }
+      }
+    }
+    if (score > best_score) {
+      best = &languages[i];
+      best_score = score;
+    }
+  }
+  return best;
+}
+
+static void write_code_text(FILE *fp, const char *text, size_t len) {
+  const char *end = text + len;
+  while (text < end) {
+    size_t run = strcspn(text, "&<>");
+    if (run > (size_t)(end - text)) {
+      run = end - text;
+    }
+    fwrite(text, 1, run, fp);
+    text += run;
+    if (text == end) {
+      break;
+    }
+    fputs(*text == '&' ? "&amp;" : *text == '<' ? "&lt;" : "&gt;", fp);
+    text++;
+  }
+}
+
+static void write_span(FILE *fp, const char *cls, const char *text,
+                       size_t len) {
+  fprintf(fp, "<span class=\"%s\">", cls);
+  write_code_text(fp, text, len);
+  fputs("</span>", fp);
+}
+
+// find_close returns the end of the delimiter close in p, or NULL if the
+// line ends first
+static const char *find_close(const char *p, const char *close,
+                              bool escapes) {
+  size_t close_len = strlen(close);
+  for (; *p; p++) {
+    if (escapes && *p == '\\' && p[1] != '\0') {
+      p++;
+    } else if (strncmp(p, close, close_len) == 0) {
+      return p + close_len;
+    }
+  }
+  return NULL;
+}
+
+// open_span writes from p to the end of the delimiter close as one span, or
+// to the end of the line and keeps the span open if multiline is set.
+// Returns where the lexer continues.
+static const char *open_span(Lexer *lx, const char *cls, const char *p,
+                             const char *from, const char *close,
+                             bool escapes, bool multiline) {
+  const char *end = find_close(from, close, escapes);
+  if (end != NULL) {
+    write_span(lx->fp, cls, p, end - p);
+    return end;
+  }
+  if (!multiline) {
+    size_t len = strlen(p);
+    write_span(lx->fp, cls, p, len);
+    return p + len;
+  }
+  fprintf(lx->fp, "<span class=\"%s\">", cls);
+  write_code_text(lx->fp, p, strlen(p));
+  lx->open_class = cls;
+  lx->close = close;
+  lx->close_escapes = escapes;
+  return p + strlen(p);
+}
+
+static const char *lex_string(Lexer *lx, const char *p, const char *quote) {
+  const Language *lang = lx->lang;
+  static const char *const triple[] = {"\"\"\"", "'''"};
+  const char *close = *quote == '"' ? "\"" : *quote == '\'' ? "'" : "`";
+  bool multiline = strchr(lang->multiline_quotes, *quote) != NULL;
+  const char *from = quote + 1;
+  if (lang->triple_quotes && quote[1] == *quote && quote[2] == *quote) {
+    close = triple[*quote == '\''];
+    multiline = true;
+    from = quote + 3;
+  }
+
+  // A quoted key is only known once the string is closed
+  const char *end = find_close(from, close, true);
+  if (end != NULL && lang->quoted_keys) {
+    const char *after = end + strspn(end, " \t");
+    if (*after == ':') {
+      write_span(lx->fp, "hljs-attr", p, end - p);
+      return end;
+    }
+  }
+  return open_span(lx, "hljs-string", p, from, close, true, multiline);
+}
+
+static const char *lex_variable(Lexer *lx, const char *p) {
+  const char *end = p + 1;
+  if (*end == '{') {
+    const char *close = strchr(end, '}');
+    end = close ? close + 1 : end + strlen(end);
+  } else if (isalpha((unsigned char)*end) || *end == '_') {
+    while (isalnum((unsigned char)*end) || *end == '_') {
+      end++;
+    }
+  } else if (*end != '\0' && strchr("0123456789?@#$*!-", *end) != NULL) {
+    end++;
+  } else {
+    write_code_text(lx->fp, p, 1);
+    return p + 1;
+  }
+  write_span(lx->fp, "hljs-variable", p, end - p);
+  return end;
+}
+
+static const char *lex_number(Lexer *lx, const char *p) {
+  const char *end = p;
+  bool hex = p[0] == '0' && (p[1] == 'x' || p[1] == 'X');
+  while (isalnum((unsigned char)*end) || *end == '_' || *end == '.' ||
+         ((*end == '+' || *end == '-') && !hex &&
+          (end[-1] == 'e' || end[-1] == 'E'))) {
+    end++;
+  }
+  write_span(lx->fp, "hljs-number", p, end - p);
+  return end;
+}
+
+static const char *lex_word(Lexer *lx, const char *p) {
+  const Language *lang = lx->lang;
+  const char *end = p;
+  while (is_word_char(lang, *end)) {
+    end++;
+  }
+  // Dashes only join words, "--" and a trailing '-' are not part of them
+  while (end > p + 1 && end[-1] == '-') {
+    end--;
+  }
+  size_t len = end - p;
+  const char *title_class = lx->title_class;
+  lx->title_class = NULL;
+
+  const char *cls = NULL;
+  TokenKind kind = TOKEN_OTHER;
+  if (in_words(lang->keywords, p, len)) {
+    cls = "hljs-keyword";
+    if (in_words(lang->title_keywords, p, len)) {
+      bool type = strncmp(p, "class", len) == 0 || strncmp(p, "type", len) == 0;
+      lx->title_class = type ? "hljs-title class_" : "hljs-title function_";
+    }
+  } else if (title_class != NULL) {
+    cls = title_class;
+  } else if (in_words(lang->types, p, len)) {
+    cls = "hljs-type";
+    kind = TOKEN_TYPE;
+  } else if (in_words(lang->literals, p, len)) {
+    cls = "hljs-literal";
+  } else if (in_words(lang->built_ins, p, len)) {
+    cls = "hljs-built_in";
+  } else {
+    kind = TOKEN_WORD;
+    const char *after = end + strspn(end, " \t");
+    if (lang->c_declarations && *after == '(' &&
+        (lx->prev == TOKEN_TYPE || lx->prev == TOKEN_WORD)) {
+      cls = "hljs-title function_";
+    }
+  }
+
+  if (cls != NULL) {
+    write_span(lx->fp, cls, p, len);
+  } else {
+    write_code_text(lx->fp, p, len);
+  }
+  lx->prev = kind;
+  return end;
+}
+
+// prefixed_quote returns the quote of a string with a one or two letter
+// prefix like r"" starting at p, or NULL
+static const char *prefixed_quote(const Language *lang, const char *line,
+                                  const char *p) {
+  if (!lang->string_prefixes || (p > line && is_word_char(lang, p[-1]))) {
+    return NULL;
+  }
+  size_t len = strspn(p, "rRbBfFuU");
+  if (len == 0 || len > 2 || p[len] == '\0' ||
+      strchr(lang->quotes, p[len]) == NULL) {
+    return NULL;
+  }
+  return p + len;
+}
+
+static void lex_line(Lexer *lx, const char *line) {
+  const Language *lang = lx->lang;
+  const char *p = line;
+  lx->prev = TOKEN_NONE;
+
+  if (lx->open_class != NULL) {
+    const char *end = find_close(p, lx->close, lx->close_escapes);
+    if (end == NULL) {
+      write_code_text(lx->fp, p, strlen(p));
+      return;
+    }
+    write_code_text(lx->fp, p, end - p);
+    fputs("</span>", lx->fp);
+    lx->open_class = NULL;
+    p = end;
+  }
+
+  size_t indent = strspn(p, " \t");
+  write_code_text(lx->fp, p, indent);
+  p += indent;
+  if (p == line + indent) {
+    if (lang->preprocessor && *p == '#') {
+      write_span(lx->fp, "hljs-meta", p, strlen(p));
+      return;
+    }
+    if (lang->decorators && *p == '@') {
+      const char *end = p + 1;
+      while (is_word_char(lang, *end) || *end == '.') {
+        end++;
+      }
+      write_span(lx->fp, "hljs-meta", p, end - p);
+      p = end;
+    }
+    size_t key_len = lang->bare_keys ? key_length(key_start(p)) : 0;
+    if (key_len > 0) {
+      const char *key = key_start(p);
+      write_code_text(lx->fp, p, key - p);
+      write_span(lx->fp, "hljs-attr", key, key_len);
+      p = key + key_len;
+    }
+  }
+
+  while (*p) {
+    const char *next;
+    const char *quote;
+    size_t comment_len = lang->line_comment ? strlen(lang->line_comment) : 0;
+    if (comment_len > 0 && strncmp(p, lang->line_comment, comment_len) == 0 &&
+        (*p != '#' || p == line || isspace((unsigned char)p[-1]))) {
+      write_span(lx->fp, "hljs-comment", p, strlen(p));
+      return;
+    }
+
+    if (lang->block_comment_open != NULL &&
+        strncmp(p, lang->block_comment_open,
+                strlen(lang->block_comment_open)) == 0) {
+      next = open_span(lx, "hljs-comment", p,
+                       p + strlen(lang->block_comment_open),
+                       lang->block_comment_close, false, true);
+    } else if (strchr(lang->quotes, *p) != NULL && *p != '\0') {
+      next = lex_string(lx, p, p);
+    } else if ((quote = prefixed_quote(lang, line, p)) != NULL) {
+      next = lex_string(lx, p, quote);
+    } else if (lang->variables && *p == '$') {
+      next = lex_variable(lx, p);
+    } else if (isdigit((unsigned char)*p) &&
+               (p == line || (!is_word_char(lang, p[-1]) && p[-1] != '.'))) {
+      next = lex_number(lx, p);
+    } else if (isalpha((unsigned char)*p) || *p == '_' ||
+               (*p == '$' && is_word_char(lang, '$'))) {
+      p = lex_word(lx, p);
+      continue;
+    } else {
+      write_code_text(lx->fp, p, 1);
+      if (!isspace((unsigned char)*p)) {
+        if (*p != '*' && *p != '&') {
+          lx->prev = TOKEN_OTHER;
+        }
+        lx->title_class = NULL;
+      }
+      p++;
+      continue;
+    }
+    lx->prev = TOKEN_OTHER;
+    lx->title_class = NULL;
+    p = next;
+  }
+}
+
+// write_highlighted_code writes the code element of a code block with the
+// tokens of its guessed language wrapped in highlight.js classed spans, so
+// the page needs no script to colour it
+void write_highlighted_code(FILE *fp, const LineList *lines) {
+  const Language *lang = lines ? detect_language(lines) : NULL;
+  if (lang != NULL) {
+    fprintf(fp, "<code class=\"hljs language-%s\">\n", lang->name);
+  } else {
+    fprintf(fp, "<code class=\"hljs\">\n");
+  }
+
+  Lexer lx = {.fp = fp, .lang = lang};
+  for (int i = 0; lines && i < lines->count; i++) {
+    if (i > 0) {
+      fputc('\n', fp);
+    }
+    if (lang != NULL) {
+      lex_line(&lx, lines->lines[i]);
+    } else {
+      write_code_text(fp, lines->lines[i], strlen(lines->lines[i]));
+    }
+  }
+  if (lx.open_class != NULL) {
+    fputs("</span>", fp);
+  }
+  fprintf(fp, "\n</code>\n");
+}
@@ -0,0 +1,10 @@
+#ifndef HIGHLIGHT_H
+#define HIGHLIGHT_H
+
+#include <stdio.h>
+
+#include "md_parser.h"
+
+void write_highlighted_code(FILE *fp, const LineList *lines);
+
+#endif
@@ -0,0 +1,17 @@
+(function () {
+const saved = localStorage.getItem('theme');
+const prefersDark = window.matchMedia('(prefers-color-scheme: light)').matches;
+const theme = saved || (prefersDark ? 'light' : 'dark');
+document.body.classList.toggle('light', theme === 'light');
+document.documentElement.dataset.theme = theme;
+document.documentElement.style.colorScheme = theme;
+const lightThemeBtn = document.querySelector('.light-theme');
+const darkThemeBtn = document.querySelector('.dark-theme');
+if (theme === 'light') {
+lightThemeBtn.classList.add('hidden');
+darkThemeBtn.classList.remove('hidden');
+} else {
+darkThemeBtn.classList.add('hidden');
+lightThemeBtn.classList.remove('hidden');
+}
+})();
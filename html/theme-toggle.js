@@ -0,0 +1,12 @@
+const themes = document.querySelectorAll('.toggle-theme');
+themes.forEach(theme => {
+theme.addEventListener('click', () => {
+const current = document.body.classList.contains('light') ? 'light' : 'dark';
+const next = current === 'light' ? 'dark' : 'light';
+localStorage.setItem('theme', next);
+document.documentElement.dataset.theme = theme;
+document.documentElement.style.colorScheme = theme;
+document.body.classList.toggle('light');
+themes.forEach(t => t.classList.toggle('hidden'));
+});
+});
@@ -0,0 +1,513 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "highlight.h"
+#include "html_writer.h"
+#include "page_html.h"
+#include "str_utils.h"
+
+#define MAX_ENTITY_LEN 32
+
+static bool is_entity_ref(const char *str);
+static int write_lines_escaped(FILE *fp, const LineList *lines,
+                               EscapeMode mode);
+static int write_entity(FILE *fp, char c);
+static void write_asset_path(FILE *fp, const HtmlOptions *opts,
+                             const char *name);
+static void write_page_part(FILE *fp, const unsigned char *part,
+                            unsigned int len);
+static void write_theme_css(FILE *fp, const HtmlOptions *opts,
+                            const MDBlock *doc);
+static void write_block(FILE *fp, const MDBlock *block, bool nested);
+static void end_line(FILE *fp);
+static bool end_tag_optional(const MDBlock *block);
+
+// PAGE_PART writes a page_html.c blob, minified with --minify
+#define PAGE_PART(fp, name)                                                    \
+  write_page_part(fp, minify_html ? name##_min : name,                         \
+                  minify_html ? name##_min_len : name##_len)
+
+bool highlight_code_blocks = false;
+bool minify_html = false;
+
+void generate_html(FILE *fp, const MDBlock *block, const HtmlOptions *opts) {
+  if (block == NULL) {
+    return;
+  }
+
+  write_html_head(fp, opts, block);
+  print_html(fp, block);
+  write_html_tail(fp, opts);
+}
+
+// write_html_head writes the page boilerplate up to the opening of the
+// content container, write_html_tail closes it. The constant parts are
+// assembled by make styles, see page_html.c. The theme css is cut down to
+// the elements of doc, or written whole if doc is NULL because the document
+// is not known yet.
+void write_html_head(FILE *fp, const HtmlOptions *opts, const MDBlock *doc) {
+  PAGE_PART(fp, page_head);
+  if (!opts->css_style) {
+    PAGE_PART(fp, page_body);
+    return;
+  }
+
+  if (opts->css_file[0] != '\0') {
+    fprintf(fp, "<link rel=\"stylesheet\" href=\"");
+    write_asset_path(fp, opts, opts->css_file);
+    fprintf(fp, "\">");
+  } else {
+    fprintf(fp, "<style>");
+    end_line(fp);
+    write_theme_css(fp, opts, doc);
+    fprintf(fp, "</style>");
+  }
+  end_line(fp);
+  if (highlight_code_blocks) {
+    PAGE_PART(fp, page_body_highlighted);
+  } else {
+    PAGE_PART(fp, page_body_styled);
+  }
+}
+
+void write_html_tail(FILE *fp, const HtmlOptions *opts) {
+  if (!opts->css_style) {
+    PAGE_PART(fp, page_tail);
+    return;
+  }
+
+  if (highlight_code_blocks) {
+    PAGE_PART(fp, page_tail_highlighted);
+  } else {
+    PAGE_PART(fp, page_tail_styled);
+  }
+  if (opts->js_file[0] != '\0') {
+    fprintf(fp, "<script src=\"");
+    write_asset_path(fp, opts, opts->js_file);
+    fprintf(fp, "\"></script>");
+    end_line(fp);
+  } else {
+    PAGE_PART(fp, page_theme_script);
+  }
+  PAGE_PART(fp, page_end);
+}
+
+// Rule groups of the theme, any other group is always written
+static const char *const css_group_names[] = {
+    "headings", "code", "highlight", "blockquote",
+    "lists", "table", "hr", "images",
+};
+
+#define CSS_GROUP_COUNT (sizeof(css_group_names) / sizeof(css_group_names[0]))
+#define CSS_GROUP_BIT(name) (1u << css_group_index(name))
+
+// Elements written by the inline parsers or found in raw html, by the rule
+// group styling them
+static const struct {
+  const char *tag;
+  const char *group;
+} css_group_tags[] = {
+    {"h1", "headings"}, {"h2", "headings"}, {"h3", "headings"},
+    {"h4", "headings"}, {"h5", "headings"}, {"h6", "headings"},
+    {"pre", "code"}, {"pre", "highlight"}, {"code", "code"},
+    {"blockquote", "blockquote"}, {"ul", "lists"}, {"ol", "lists"},
+    {"li", "lists"}, {"table", "table"}, {"tr", "table"},
+    {"th", "table"}, {"td", "table"}, {"hr", "hr"},
+    {"img", "images"},
+};
+
+#define CSS_GROUP_TAG_COUNT                                                    \
+  (sizeof(css_group_tags) / sizeof(css_group_tags[0]))
+
+static unsigned int css_group_index(const char *name) {
+  for (unsigned int i = 0; i < CSS_GROUP_COUNT; i++) {
+    if (strcmp(css_group_names[i], name) == 0) {
+      return i;
+    }
+  }
+  return CSS_GROUP_COUNT;
+}
+
+// text_css_groups adds the groups of the html tags in text, and of the
+// images and code spans of text that is not inline parsed yet
+static unsigned int text_css_groups(const char *text) {
+  if (text == NULL) {
+    return 0;
+  }
+  unsigned int groups = 0;
+  if (strstr(text, "![") != NULL) {
+    groups |= CSS_GROUP_BIT("images");
+  }
+  if (strchr(text, '`') != NULL) {
+    groups |= CSS_GROUP_BIT("code");
+  }
+  for (const char *p = strchr(text, '<'); p != NULL; p = strchr(p + 1, '<')) {
+    const char *name = p + 1;
+    size_t len = 0;
+    while (isalnum((unsigned char)name[len])) {
+      len++;
+    }
+    for (size_t i = 0; len > 0 && i < CSS_GROUP_TAG_COUNT; i++) {
+      if (strncasecmp(name, css_group_tags[i].tag, len) == 0 &&
+          css_group_tags[i].tag[len] == '\0') {
+        groups |= CSS_GROUP_BIT(css_group_tags[i].group);
+      }
+    }
+  }
+  return groups;
+}
+
+// css_groups_used returns the rule groups styling the blocks from block on
+// and their descendants
+static unsigned int css_groups_used(const MDBlock *block) {
+  unsigned int groups = 0;
+  for (; block != NULL; block = block->next) {
+    switch (block->block) {
+    case H1:
+    case H2:
+    case H3:
+    case H4:
+    case H5:
+    case H6:
+      groups |= CSS_GROUP_BIT("headings");
+      break;
+    case CODEBLOCK:
+      groups |= CSS_GROUP_BIT("code") | CSS_GROUP_BIT("highlight");
+      break;
+    case BLOCKQUOTE:
+      groups |= CSS_GROUP_BIT("blockquote");
+      break;
+    case ORDERED_LIST:
+    case UNORDERED_LIST:
+    case LIST_ITEM:
+      groups |= CSS_GROUP_BIT("lists");
+      break;
+    case HORIZONTAL_LINE:
+      groups |= CSS_GROUP_BIT("hr");
+      break;
+    case HTML_TAG:
+      for (int i = 0; block->lines && i < block->lines->count; i++) {
+        groups |= text_css_groups(block->lines->lines[i]);
+      }
+      break;
+    default:
+      break;
+    }
+    if (block->block != CODEBLOCK && block->block != HTML_TAG) {
+      groups |= text_css_groups(block->content);
+    }
+    groups |= css_groups_used(block->child);
+  }
+  return groups;
+}
+
+// write_theme_css writes the rule groups of the theme styling the elements
+// of doc
+static void write_theme_css(FILE *fp, const HtmlOptions *opts,
+                            const MDBlock *doc) {
+  if (opts->css_groups == NULL || doc == NULL) {
+    write_css(fp, opts->css_theme, (size_t)opts->css_theme_len);
+    return;
+  }
+
+  unsigned int used = css_groups_used(doc);
+  for (unsigned int i = 0; i < opts->css_group_count; i++) {
+    const CssGroup *group = &opts->css_groups[i];
+    unsigned int index = css_group_index(group->name);
+    if (index == CSS_GROUP_COUNT || (used & (1u << index))) {
+      write_css(fp, group->css, group->len);
+    }
+  }
+}
+
+static void write_page_part(FILE *fp, const unsigned char *part,
+                            unsigned int len) {
+  fwrite(part, 1, len, fp);
+}
+
+// write_asset_path writes the path of a shared theme file relative to the
+// page
+static void write_asset_path(FILE *fp, const HtmlOptions *opts,
+                             const char *name) {
+  for (int i = 0; i < opts->asset_depth; i++) {
+    fputs("../", fp);
+  }
+  fputs(name, fp);
+}
+
+// print_html writes the html fragment of the block list to fp. The block tree
+// is only read, so the same parsed document can be rendered more than once.
+void print_html(FILE *fp, const MDBlock *block) {
+  for (; block != NULL; block = block->next) {
+    write_block(fp, block, false);
+  }
+}
+
+// print_html_block writes the html of block and its children, without the
+// blocks following it.
+void print_html_block(FILE *fp, const MDBlock *block) {
+  write_block(fp, block, false);
+}
+
+// write_block writes block and its children. A block nested in a container is
+// rendered with all of its siblings known, so only then may --minify leave
+// out an end tag that depends on what follows.
+static void write_block(FILE *fp, const MDBlock *block, bool nested) {
+  if (block->block == SECTION_BREAK || block->block == LINK_REFERENCE) {
+    return;
+  }
+
+  if (block->child != NULL) {
+    fprintf(fp, "<%s>", block->tag);
+    end_line(fp);
+    for (const MDBlock *child = block->child; child != NULL;
+         child = child->next) {
+      write_block(fp, child, true);
+    }
+  } else if (block->block == HTML_TAG) {
+    // Raw html and bare text keep their newline, it may be the only space
+    // between them and the next block
+    write_lines_escaped(fp, block->lines, ESCAPE_RAW);
+    fprintf(fp, "\n");
+    return;
+  } else if (block->type == NONE) {
+    html_write_escaped(fp, block->content, ESCAPE_INLINE);
+    fprintf(fp, "\n");
+    return;
+  } else if (block->type == SELF_CLOSING) {
+    fprintf(fp, minify_html ? "<%s>" : "<%s />", block->tag);
+    end_line(fp);
+    return;
+  } else if (block->type == BLOCK) {
+    char *heading_id;
+    switch (block->block) {
+    case H1:
+    case H2:
+    case H3:
+    case H4:
+    case H5:
+    case H6:
+      heading_id = convert_id_tag(block->content);
+      fprintf(fp, "<%s id=\"%s\">", block->tag, heading_id);
+      free(heading_id);
+      break;
+    default:
+      fprintf(fp, "<%s>", block->tag);
+    }
+    // A newline right after <pre> is dropped by the browser, the ones in the
+    // code are kept as they are
+    end_line(fp);
+    if (block->block == CODEBLOCK && highlight_code_blocks) {
+      write_highlighted_code(fp, block->lines);
+    } else if (block->block == CODEBLOCK) {
+      fprintf(fp, "<code>\n");
+      write_lines_escaped(fp, block->lines, ESCAPE_CODE);
+      fprintf(fp, "\n</code>\n");
+    } else if (block->content != NULL) {
+      html_write_escaped(fp, block->content, ESCAPE_INLINE);
+      end_line(fp);
+    }
+  } else {
+    LOGF("Unknown block type: %d\n", block->type);
+    return;
+  }
+
+  if (!(minify_html && nested && end_tag_optional(block))) {
+    fprintf(fp, "</%s>", block->tag);
+    end_line(fp);
+  }
+}
+
+// end_line ends a line of markup, --minify writes it all on one line
+static void end_line(FILE *fp) {
+  if (!minify_html) {
+    fputc('\n', fp);
+  }
+}
+
+// end_tag_optional checks if html lets the end tag of a nested block be left
+// out: a list item's always, as it is followed by another item or the end of
+// its list, and a paragraph's when a block element or the end of its
+// container follows it.
+static bool end_tag_optional(const MDBlock *block) {
+  if (block->block == LIST_ITEM) {
+    return true;
+  }
+  if (block->block != PARAGRAPH) {
+    return false;
+  }
+
+  const MDBlock *next = block->next;
+  while (next != NULL &&
+         (next->block == SECTION_BREAK || next->block == LINK_REFERENCE)) {
+    next = next->next;
+  }
+  if (next == NULL) {
+    return true;
+  }
+  switch (next->block) {
+  case H1:
+  case H2:
+  case H3:
+  case H4:
+  case H5:
+  case H6:
+  case PARAGRAPH:
+  case BLOCKQUOTE:
+  case ORDERED_LIST:
+  case UNORDERED_LIST:
+  case CODEBLOCK:
+  case HORIZONTAL_LINE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+int write_css(FILE *fp, const unsigned char *p, size_t n) {
+  size_t remaining = n;
+
+  while (remaining > 0) {
+    size_t written = fwrite(p, 1, remaining, fp);
+    if (written == 0) {
+      return -1;
+    }
+    p += written;
+    remaining -= written;
+  }
+  return 0;
+}
+
+// html_write_escaped writes str to fp in a single pass, copying verbatim runs
+// in bulk and only handling the characters that need escaping in the given
+// mode. The input string is never modified.
+// Returns 0 on success, -1 on write error.
+int html_write_escaped(FILE *fp, const char *str, EscapeMode mode) {
+  if (str == NULL) {
+    return 0;
+  }
+
+  const char *stops;
+  switch (mode) {
+  case ESCAPE_INLINE:
+    stops = "\\&";
+    break;
+  case ESCAPE_CODE:
+    stops = "&<>";
+    break;
+  case ESCAPE_RAW:
+  default:
+    stops = "\\";
+  }
+
+  const char *p = str;
+  while (*p) {
+    size_t run = strcspn(p, stops);
+    if (run > 0 && fwrite(p, 1, run, fp) != run) {
+      return -1;
+    }
+    p += run;
+    if (*p == '\0') {
+      break;
+    }
+
+    if (*p == '\\') {
+      if (p[1] != '\0' && strchr(MD_ESCAPABLE_CHARS, p[1]) != NULL) {
+        // Drop the backslash, the escaped character is output literally
+        p++;
+        if (mode == ESCAPE_INLINE && (*p == '<' || *p == '>')) {
+          if (write_entity(fp, *p) < 0) {
+            return -1;
+          }
+        } else if (fputc(*p, fp) == EOF) {
+          return -1;
+        }
+      } else if (fputc('\\', fp) == EOF) {
+        return -1;
+      }
+      p++;
+      continue;
+    }
+
+    // '&', '<' or '>'
+    if (*p == '&' && mode == ESCAPE_INLINE && is_entity_ref(p)) {
+      if (fputc('&', fp) == EOF) {
+        return -1;
+      }
+    } else if (write_entity(fp, *p) < 0) {
+      return -1;
+    }
+    p++;
+  }
+
+  return 0;
+}
+
+// write_lines_escaped writes the verbatim lines of a block separated by
+// newlines, straight from the source lines they point to.
+static int write_lines_escaped(FILE *fp, const LineList *lines,
+                               EscapeMode mode) {
+  if (lines == NULL) {
+    return 0;
+  }
+
+  for (int i = 0; i < lines->count; i++) {
+    if (i > 0 && fputc('\n', fp) == EOF) {
+      return -1;
+    }
+    if (html_write_escaped(fp, lines->lines[i], mode) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// is_entity_ref checks if str, which starts with '&', is a named, decimal or
+// hexadecimal character reference that should be passed through untouched.
+static bool is_entity_ref(const char *str) {
+  const char *p = str + 1;
+  size_t len = 0;
+
+  if (*p == '#') {
+    p++;
+    if (*p == 'x' || *p == 'X') {
+      p++;
+      while (len < MAX_ENTITY_LEN && isxdigit((unsigned char)p[len])) {
+        len++;
+      }
+    } else {
+      while (len < MAX_ENTITY_LEN && isdigit((unsigned char)p[len])) {
+        len++;
+      }
+    }
+  } else if (isalpha((unsigned char)*p)) {
+    while (len < MAX_ENTITY_LEN && isalnum((unsigned char)p[len])) {
+      len++;
+    }
+  }
+
+  return len > 0 && p[len] == ';';
+}
+
+static int write_entity(FILE *fp, char c) {
+  const char *entity;
+  switch (c) {
+  case '&':
+    entity = "&amp;";
+    break;
+  case '<':
+    entity = "&lt;";
+    break;
+  case '>':
+    entity = "&gt;";
+    break;
+  default:
+    return fputc(c, fp) == EOF ? -1 : 0;
+  }
+
+  return fputs(entity, fp) == EOF ? -1 : 0;
+}
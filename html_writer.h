@@ -0,0 +1,59 @@
+#ifndef HTML_WRITER_H
+#define HTML_WRITER_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "md_parser.h"
+#include "style_css.h"
+
+// Markdown escapable characters, a backslash before any of these is dropped
+#define MD_ESCAPABLE_CHARS "\\`*_{}[]<>()#+-.!|"
+
+typedef enum {
+  // Inline markdown content: drop backslash escapes, entity-encode escaped
+  // '<' / '>' and bare '&'. Unescaped tags are kept since they are either
+  // generated by the inline parsers or raw inline html.
+  ESCAPE_INLINE,
+  // Code content: entity-encode every '&', '<' and '>', keep backslashes.
+  ESCAPE_CODE,
+  // Raw html content: only drop backslash escapes.
+  ESCAPE_RAW,
+} EscapeMode;
+
+// Longest file name of a shared theme file
+#define ASSET_NAME_MAX 64
+
+typedef struct {
+  bool css_style;
+  const unsigned char *css_theme;
+  unsigned int css_theme_len;
+  // css_theme split into rule groups, pages only embed the groups of the
+  // elements they have. NULL to always embed all of css_theme.
+  const CssGroup *css_groups;
+  unsigned int css_group_count;
+  // Theme files linked by the pages instead of inlined in each of them,
+  // empty when inlined. Pages asset_depth directories below them link
+  // through "../".
+  char css_file[ASSET_NAME_MAX];
+  char js_file[ASSET_NAME_MAX];
+  int asset_depth;
+} HtmlOptions;
+
+// Set before rendering to highlight code blocks while converting, the page
+// then does not load highlight.js
+extern bool highlight_code_blocks;
+// Set before rendering to write the page without newlines outside of <pre>,
+// the optional end tags and with the minified theme
+extern bool minify_html;
+
+void generate_html(FILE *fp, const MDBlock *block, const HtmlOptions *opts);
+void write_html_head(FILE *fp, const HtmlOptions *opts, const MDBlock *doc);
+void write_html_tail(FILE *fp, const HtmlOptions *opts);
+void print_html(FILE *fp, const MDBlock *block);
+void print_html_block(FILE *fp, const MDBlock *block);
+
+int html_write_escaped(FILE *fp, const char *str, EscapeMode mode);
+int write_css(FILE *fp, const unsigned char *p, size_t n);
+
+#endif
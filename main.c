@@ -1,39 +1,119 @@
+#include <errno.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+#include "assets.h"
+#include "ast.h"
+#include "batch_io.h"
+#include "block_cache.h"
 #include "debug.h"
+#include "events.h"
 #include "file_reader.h"
+#include "html_writer.h"
 #include "logger.h"
 #include "md_regex.h"
+#include "mem_profile.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "precompress.h"
+#include "stats.h"
 #include "str_utils.h"
 #include "style_css.h"
-
-void generate_html(MDBlock *block, const unsigned char *css_theme,
-                   unsigned int css_theme_len);
-void print_html(MDBlock *block);
-
-int write_css(FILE *fp, const unsigned char *p, size_t n);
-void write_highlight_js(FILE *fp, int action);
-void write_theme_toggler(FILE *fp, int action);
+#include "thread_pool.h"
+#include "trace.h"
+#include "watch.h"
 
 static bool debug_mode = false;
 static bool test_mode = false;
 static bool css_style = true;
+// Compressed copies and ETag sidecar written next to every output file
+static unsigned int precompress_formats = 0;
+static bool write_etag = false;
+
+// Every output is rendered from the same parsed document
+typedef struct {
+  const char *path; // NULL for stdout
+  FILE *fp;
+  bool fragment; // bare html fragment without page boilerplate
+} OutputTarget;
+
+#define MAX_OUTPUTS 2
+
+static int open_output(OutputTarget *target);
+static void close_output(OutputTarget *target);
+static void write_rendered_output(OutputTarget *target, const MDBlock *head,
+                                  const RenderedBody *body,
+                                  const HtmlOptions *opts);
+static int convert_pipelined(FILE *md_file, OutputTarget *outputs,
+                             int output_count, const HtmlOptions *opts);
+static int convert_from_ast(const char *ast_path, OutputTarget *outputs,
+                            int output_count, const HtmlOptions *opts);
+static int finish_run(const char *stats_path);
+static int write_page_assets(const char *output_dir, const char *output_path,
+                             HtmlOptions *opts);
+static int convert_files(int argc, char *argv[], const char *output_dir,
+                         bool use_io_uring, bool fragment,
+                         const HtmlOptions *opts, BlockCache *cache);
 
 static const char *version = "{{VERSION}}";
 
 static void usage(const char *prog_name) {
   fprintf(stdout,
           "Usage: %s [options] <markdown_file>\n"
+          "       %s --output-dir=DIR [options] <markdown_file>...\n"
+          "       %s --from-ast=FILE [options]\n"
           "\n"
           "Options: \n"
           "  --help             Show this help message\n"
           "  --output=FILE      Specify output html file (default: stdout)\n"
+          "  --fragment-output=FILE\n"
+          "                     Also write the bare html fragment to FILE\n"
+          "  --output-dir=DIR   Convert every markdown file given into DIR\n"
+          "  --no-io-uring      Read and write --output-dir files without\n"
+          "                     io_uring\n"
+          "  --cache-dir=DIR    Reuse the html of large blocks rendered by\n"
+          "                     earlier runs, cached in DIR; cannot be\n"
+          "                     combined with --jobs, --pipeline or --watch\n"
+          "  --cache-size=MB    Size the cache is kept under (default: 64)\n"
+          "  --emit-ast=FILE    Also save the parsed document to FILE\n"
+          "  --from-ast=FILE    Render a document saved with --emit-ast\n"
+          "                     instead of parsing markdown\n"
+          "  --events           Write the block, text and link events of the\n"
+          "                     streaming parser instead of html\n"
           "  --no-style         Disable CSS styling in the output HTML\n"
+          "  --highlight        Highlight code blocks while converting instead\n"
+          "                     of loading highlight.js in the page\n"
+          "  --minify           Write compact html, css and js, without\n"
+          "                     newlines or optional end tags\n"
+          "  --external-assets  Write the theme css and script once next to\n"
+          "                     the output and link them from every page\n"
+          "  --precompress=LIST Also write gzip and/or zstd compressed copies\n"
+          "                     of every output file, e.g. gzip,zstd\n"
+          "  --etag             Also write the ETag of every output file to\n"
+          "                     FILE.etag\n"
+          "  --stats[=FILE]     Print per phase timing, block and memory stats\n"
+          "                     to stderr, or as JSON to FILE\n"
+          "  --trace=FILE       Write Chrome trace events of the parser and\n"
+          "                     renderer to FILE\n"
+          "  --mem-profile      Print live heap by category after parsing\n"
+          "  --jobs=N           Parse and render on N threads, 0 for\n"
+          "                     one per cpu (default: 1)\n"
+          "  --verify-parallel  Check parallel block parsing against the\n"
+          "                     sequential parser, using the smallest chunks\n"
+          "  --pipeline         Read, block parse and render on three threads\n"
+          "                     connected by queues, overrides --jobs; from\n"
+          "                     the first block with a link on, rendering\n"
+          "                     waits for the whole input, and the full theme\n"
+          "                     is inlined\n"
+          "  --watch            Convert again whenever the markdown file\n"
+          "                     changes, re-rendering only the changed blocks;\n"
+          "                     requires --output\n"
           "  --debug            Enable debug logging\n"
           "  --test             For testing purposes only\n"
           "  --version          Show version information\n",
-          prog_name);
+          prog_name, prog_name, prog_name);
 }
 
 int main(int argc, char *argv[]) {
@@ -54,6 +134,21 @@ int main(int argc, char *argv[]) {
   }
 
   const char *output_path = NULL;
+  const char *fragment_path = NULL;
+  const char *stats_path = NULL;
+  const char *trace_path = NULL;
+  int jobs = 1;
+  bool verify_parallel = false;
+  bool pipeline = false;
+  const char *output_dir = NULL;
+  bool use_io_uring = true;
+  bool watch = false;
+  const char *cache_dir = NULL;
+  size_t cache_mb = BLOCK_CACHE_DEFAULT_MB;
+  const char *emit_ast_path = NULL;
+  const char *from_ast_path = NULL;
+  bool events = false;
+  bool external_assets = false;
   const unsigned char *css_theme = default_theme_css;
   unsigned int css_theme_len = default_theme_css_len;
   for (int i = 1; i < argc; i++) {
@@ -69,14 +164,171 @@ int main(int argc, char *argv[]) {
     if (strncmp(argv[i], "--output=", 9) == 0) {
       output_path = argv[i] + 9;
     }
+    if (strncmp(argv[i], "--fragment-output=", 18) == 0) {
+      fragment_path = argv[i] + 18;
+    }
+    if (strcmp(argv[i], "--stats") == 0) {
+      stats_enable();
+    }
+    if (strncmp(argv[i], "--stats=", 8) == 0) {
+      stats_path = argv[i] + 8;
+      stats_enable();
+    }
+    if (strncmp(argv[i], "--trace=", 8) == 0) {
+      trace_path = argv[i] + 8;
+    }
+    if (strcmp(argv[i], "--mem-profile") == 0) {
+      mem_profile_enable();
+    }
+    if (strncmp(argv[i], "--jobs=", 7) == 0) {
+      jobs = atoi(argv[i] + 7);
+      if (jobs <= 0) {
+        jobs = default_job_count();
+      }
+    }
+    if (strcmp(argv[i], "--verify-parallel") == 0) {
+      verify_parallel = true;
+    }
+    if (strcmp(argv[i], "--pipeline") == 0) {
+      pipeline = true;
+    }
+    if (strncmp(argv[i], "--output-dir=", 13) == 0) {
+      output_dir = argv[i] + 13;
+    }
+    if (strcmp(argv[i], "--no-io-uring") == 0) {
+      use_io_uring = false;
+    }
+    if (strcmp(argv[i], "--watch") == 0) {
+      watch = true;
+    }
+    if (strncmp(argv[i], "--cache-dir=", 12) == 0) {
+      cache_dir = argv[i] + 12;
+    }
+    if (strncmp(argv[i], "--cache-size=", 13) == 0) {
+      cache_mb = strtoul(argv[i] + 13, NULL, 10);
+    }
+    if (strncmp(argv[i], "--emit-ast=", 11) == 0) {
+      emit_ast_path = argv[i] + 11;
+    }
+    if (strncmp(argv[i], "--from-ast=", 11) == 0) {
+      from_ast_path = argv[i] + 11;
+    }
+    if (strcmp(argv[i], "--events") == 0) {
+      events = true;
+    }
+    if (strcmp(argv[i], "--highlight") == 0) {
+      highlight_code_blocks = true;
+    }
+    if (strcmp(argv[i], "--minify") == 0) {
+      minify_html = true;
+    }
+    if (strcmp(argv[i], "--external-assets") == 0) {
+      external_assets = true;
+    }
+    if (strncmp(argv[i], "--precompress=", 14) == 0 &&
+        parse_precompress_formats(argv[i] + 14, &precompress_formats) != 0) {
+      return 1;
+    }
+    if (strcmp(argv[i], "--etag") == 0) {
+      write_etag = true;
+    }
   }
   log_init(debug_mode);
   LOGF("Debug mode enabled\n");
 
-  if (output_path != NULL) {
-    FILE *output_file = freopen(output_path, "w", stdout);
-    if (!output_file) {
-      fprintf(stderr, "Failed to open output file: %s\n", output_path);
+  if (emit_ast_path != NULL &&
+      (pipeline || output_dir != NULL || watch || from_ast_path != NULL)) {
+    fprintf(stderr, "--emit-ast cannot be combined with --pipeline, "
+                    "--output-dir, --watch or --from-ast\n");
+    return 1;
+  }
+
+  // Only the single threaded and --output-dir conversions read the cache
+  if (cache_dir != NULL && output_dir == NULL &&
+      (jobs > 1 || verify_parallel || pipeline || watch)) {
+    fprintf(stderr, "--cache-dir cannot be combined with --jobs, "
+                    "--verify-parallel, --pipeline or --watch\n");
+    return 1;
+  }
+
+  if (precompress_formats != 0 || write_etag) {
+    if (watch) {
+      fprintf(stderr, "--precompress and --etag cannot be combined with "
+                      "--watch\n");
+      return 1;
+    }
+    if (output_path == NULL && output_dir == NULL) {
+      fprintf(stderr, "--precompress and --etag require --output or "
+                      "--output-dir\n");
+      return 1;
+    }
+  }
+
+  if (verify_parallel && jobs < 2) {
+    jobs = 2;
+  }
+
+  if (trace_path != NULL && trace_open(trace_path) != 0) {
+    return 1;
+  }
+
+  const CssGroup *css_groups = default_theme_css_groups;
+  if (minify_html) {
+    css_theme = default_theme_css_min;
+    css_theme_len = default_theme_css_min_len;
+    css_groups = default_theme_css_min_groups;
+  }
+  HtmlOptions html_opts = {.css_style = css_style,
+                           .css_theme = css_theme,
+                           .css_theme_len = css_theme_len,
+                           .css_groups = css_groups,
+                           .css_group_count = default_theme_css_group_count};
+  // Pages of --test have no head to link the theme from
+  if (external_assets && css_style && !test_mode &&
+      write_page_assets(output_dir, output_path, &html_opts) != 0) {
+    return 1;
+  }
+  // The saved document must be fully inline parsed, which cache hits are not
+  BlockCache *cache = NULL;
+  if (cache_dir != NULL && emit_ast_path == NULL) {
+    cache = open_block_cache(cache_dir, cache_mb * 1024 * 1024);
+    if (!cache) {
+      return 1;
+    }
+  }
+
+  if (output_dir != NULL) {
+    // Blocks found in the cache are not inline parsed
+    defer_inline_parsing = cache != NULL;
+    int status = convert_files(argc, argv, output_dir, use_io_uring,
+                               test_mode, &html_opts, cache);
+    close_block_cache(cache);
+    if (status != 0) {
+      return status;
+    }
+    return finish_run(stats_path);
+  }
+  if (watch) {
+    if (output_path == NULL) {
+      fprintf(stderr, "--watch requires --output\n");
+      return 1;
+    }
+    return watch_file(argv[argc - 1], output_path, test_mode, &html_opts);
+  }
+
+  OutputTarget outputs[MAX_OUTPUTS];
+  int output_count = 0;
+  outputs[output_count++] =
+      (OutputTarget){.path = output_path, .fp = NULL, .fragment = test_mode};
+  if (fragment_path != NULL) {
+    outputs[output_count++] =
+        (OutputTarget){.path = fragment_path, .fp = NULL, .fragment = true};
+  }
+  for (int i = 0; i < output_count; i++) {
+    if (open_output(&outputs[i]) != 0) {
+      for (int j = 0; j < i; j++) {
+        close_output(&outputs[j]);
+      }
       return 1;
     }
   }
@@ -89,9 +341,17 @@ int main(int argc, char *argv[]) {
   //   fclose(css_file);
   // }
 
+  if (from_ast_path != NULL) {
+    int status =
+        convert_from_ast(from_ast_path, outputs, output_count, &html_opts);
+    close_block_cache(cache);
+    if (status != 0) {
+      return status;
+    }
+    return finish_run(stats_path);
+  }
+
   MDBlock *head_block = NULL;
-  MDBlock *tail_block = head_block;
-  MDBlock *new_block = NULL;
 
   FILE *md_file = fopen(argv[argc - 1], "r");
   if (!md_file) {
@@ -99,47 +359,128 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
-  // Read through the file to get all reference links
-  PeekReader *reader = new_peek_reader_from_file(md_file, DEFAULT_PEEK_COUNT);
-  if (!reader) {
-    fprintf(stderr, "Failed to create peek reader\n");
+  if (events) {
+    TRACE_BEGIN("events");
+    int status = print_events(outputs[0].fp, md_file);
+    TRACE_END("events");
+    fclose(md_file);
+    for (int i = 0; i < output_count; i++) {
+      close_output(&outputs[i]);
+    }
+    if (status != 0) {
+      return 1;
+    }
+    return finish_run(stats_path);
+  }
+
+  if (pipeline) {
+    int status = convert_pipelined(md_file, outputs, output_count, &html_opts);
+    fclose(md_file);
+    if (status != 0) {
+      return status;
+    }
+    return finish_run(stats_path);
+  }
+
+  // Load the file once, both passes read lines from memory
+  STATS_BEGIN(PHASE_READ);
+  TRACE_BEGIN("read");
+  MDSource *source = new_md_source(md_file);
+  fclose(md_file);
+  TRACE_END("read");
+  STATS_END();
+  if (!source) {
+    fprintf(stderr, "Failed to read file: %s\n", argv[argc - 1]);
     return 1;
   }
-  MDLinkReference *link_ref_head = gen_markdown_link_reference_list(reader);
-  free_peek_reader(reader);
+  stats_set_input(source->line_count, source->size);
+
+  // With several jobs the reference pass and block parsing run on chunks of
+  // the source on the pool, then ranges of top level blocks are inline parsed
+  // and rendered on it
+  ThreadPool *pool = NULL;
+  if (jobs > 1) {
+    pool = new_thread_pool(jobs);
+    if (!pool) {
+      return 1;
+    }
+    defer_inline_parsing = true;
+  } else if (cache) {
+    // Blocks found in the cache are not inline parsed
+    defer_inline_parsing = true;
+  }
+
+  // Read through the file to get all reference links
+  STATS_BEGIN(PHASE_REFERENCES);
+  TRACE_BEGIN("references");
+  MDLinkReference *link_ref_head = collect_link_references(pool, source);
+  TRACE_END("references");
+  STATS_END();
 
-  rewind(md_file);
-  reader = new_peek_reader_from_file(md_file, DEFAULT_PEEK_COUNT);
+  PeekReader *reader = new_peek_reader_from_source(source, DEFAULT_PEEK_COUNT);
   if (!reader) {
     fprintf(stderr, "Failed to create peek reader\n");
     return 1;
   }
 
-  do {
-    new_block = block_parsing(NULL, tail_block, reader, link_ref_head);
-
-    if (new_block != NULL) {
-      LOGF("block: %d, content: %s\n", new_block->block, new_block->content);
-
-      child_parsing_exec(link_ref_head, tail_block);
-      inline_parsing(link_ref_head, tail_block);
-
-      if (head_block == NULL) {
-        head_block = new_block;
-        tail_block = head_block;
-      } else {
-        tail_block->next = new_block;
-        tail_block = new_block;
-      }
+  RenderedBody *body = NULL;
+  STATS_BEGIN(PHASE_BLOCK);
+  if (pool) {
+    // Verification splits at every possible seam to exercise the repair
+    int chunk_lines = verify_parallel ? 1 : 0;
+    if (parse_blocks_parallel(pool, source, link_ref_head, chunk_lines,
+                              &head_block) != 0) {
+      return 1;
     }
-  } while (reader->count > 0);
+  } else if (cache) {
+    body = render_blocks_cached(cache, source, link_ref_head, &head_block);
+    if (!body) {
+      return 1;
+    }
+  } else {
+    head_block = document_block_parsing(link_ref_head, reader);
+  }
+  STATS_END();
+
+  if (verify_parallel) {
+    MDBlock *sequential = document_block_parsing(link_ref_head, reader);
+    int diff = verify_parallel_blocks(head_block, sequential);
+    free_mdblocks(sequential);
+    if (diff >= 0) {
+      fprintf(stderr,
+              "Parallel block parsing differs from sequential parsing at top "
+              "level block %d\n",
+              diff);
+      return 1;
+    }
+  }
 
-  fclose(md_file);
+  if (pool) {
+    TRACE_BEGIN("render_blocks_parallel");
+    body = render_blocks_parallel(pool, link_ref_head, head_block);
+    TRACE_END("render_blocks_parallel");
+    free_thread_pool(pool);
+    if (!body) {
+      return 1;
+    }
+  }
 
-  child_parsing_exec(link_ref_head, tail_block);
-  inline_parsing(link_ref_head, tail_block);
+  if (emit_ast_path != NULL) {
+    TRACE_BEGIN("emit_ast");
+    int status = write_ast(emit_ast_path, head_block);
+    TRACE_END("emit_ast");
+    if (status != 0) {
+      return 1;
+    }
+  }
 
+  if (mem_profile_enabled) {
+    mem_profile_snapshot(head_block, link_ref_head, source);
+  }
   free_md_link_reference(link_ref_head);
+  if (stats_enabled) {
+    stats_count_blocks(head_block);
+  }
 
   // Traverse block list
   LOGF("\n=== Traverse block list ===\n");
@@ -147,208 +488,462 @@ int main(int argc, char *argv[]) {
 
   // Generate HTML
   LOGF("\n=== Generate HTML ===\n");
-  if (test_mode) {
-    print_html(head_block);
-  } else {
-    generate_html(head_block, css_theme, css_theme_len);
+  STATS_BEGIN(PHASE_RENDER);
+  for (int i = 0; i < output_count; i++) {
+    TRACE_BEGIN("render");
+    if (body) {
+      write_rendered_output(&outputs[i], head_block, body, &html_opts);
+    } else if (outputs[i].fragment) {
+      print_html(outputs[i].fp, head_block);
+    } else {
+      generate_html(outputs[i].fp, head_block, &html_opts);
+    }
+    close_output(&outputs[i]);
+    if (trace_enabled) {
+      trace_end("render", "\"output\": %d, \"fragment\": %s", i,
+                outputs[i].fragment ? "true" : "false");
+    }
   }
+  STATS_END();
 
+  free_rendered_body(body);
   free_mdblocks(head_block);
   free_peek_reader(reader);
+  free_md_source(source);
+  close_block_cache(cache);
 
+  return finish_run(stats_path);
+}
+
+// convert_from_ast renders every output from a document saved with
+// --emit-ast, then closes the outputs
+static int convert_from_ast(const char *ast_path, OutputTarget *outputs,
+                            int output_count, const HtmlOptions *opts) {
+  STATS_BEGIN(PHASE_READ);
+  TRACE_BEGIN("load_ast");
+  AstDocument *doc = load_ast(ast_path);
+  TRACE_END("load_ast");
+  STATS_END();
+  if (!doc) {
+    for (int i = 0; i < output_count; i++) {
+      close_output(&outputs[i]);
+    }
+    return 1;
+  }
+  stats_set_input(0, doc->size);
+  if (stats_enabled) {
+    stats_count_blocks(doc->head);
+  }
+
+  STATS_BEGIN(PHASE_RENDER);
+  for (int i = 0; i < output_count; i++) {
+    TRACE_BEGIN("render");
+    if (outputs[i].fragment) {
+      print_html(outputs[i].fp, doc->head);
+    } else {
+      generate_html(outputs[i].fp, doc->head, opts);
+    }
+    close_output(&outputs[i]);
+    TRACE_END("render");
+  }
+  STATS_END();
+
+  free_ast_document(doc);
   return 0;
 }
 
-// void generate_html(MDBlock *block, char *css_filepath) {
-void generate_html(MDBlock *block, const unsigned char *css_theme,
-                   unsigned int css_theme_len) {
-  if (block == NULL) {
-    return;
-  }
-
-  printf("<!DOCTYPE html>\n");
-  printf("<html>\n");
-  printf("<head>\n");
-  printf("<meta charset=\"UTF-8\">\n");
-  printf("<title>Placeholder title</title>\n");
-  printf("<meta name=\"viewport\" content=\"width=device-width, "
-         "initial-scale=1.0\">\n");
-  if (css_style) {
-    printf("<style>\n");
-    write_css(stdout, css_theme, (size_t)css_theme_len);
-    printf("</style>\n");
-    write_highlight_js(stdout, 0);
-  }
-  printf("</head>\n");
-  printf("<body>\n");
-  if (css_style) {
-    write_theme_toggler(stdout, 0);
-  }
-  printf("<div class=\"container\">\n");
-  print_html(block);
-  printf("</div>\n");
-  if (css_style) {
-    write_highlight_js(stdout, 1);
-    write_theme_toggler(stdout, 1);
-  }
-  printf("</body>\n");
-  printf("</html>\n");
+// finish_run closes the trace and reports the profiles once every output is
+// written
+static int finish_run(const char *stats_path) {
+  trace_close();
+
+  if (mem_profile_enabled) {
+    mem_profile_report(stderr);
+  }
+
+  if (stats_enabled && stats_report(stats_path) != 0) {
+    return 1;
+  }
+
+  return 0;
 }
 
-void print_html(MDBlock *block) {
-  if (block == NULL) {
-    return;
-  }
-
-  if (block->block == SECTION_BREAK || block->block == LINK_REFERENCE) {
-    print_html(block->next);
-    return;
-  }
-
-  if (block->child != NULL) {
-    printf("<%s>\n", block->tag);
-    print_html(block->child);
-    printf("</%s>\n", block->tag);
-  } else if (block->type == NONE) {
-    escape_char_parsing(block->content);
-    printf("%s\n", block->content);
-  } else if (block->type == SELF_CLOSING) {
-    printf("<%s />\n", block->tag);
-  } else if (block->type == BLOCK) {
-    char *heading_id;
-    switch (block->block) {
-    case H1:
-    case H2:
-    case H3:
-    case H4:
-    case H5:
-    case H6:
-      heading_id = convert_id_tag(block->content);
-      printf("<%s id=\"%s\">\n", block->tag, heading_id);
-      free(heading_id);
-      break;
-    default:
-      printf("<%s>\n", block->tag);
+static int open_output(OutputTarget *target) {
+  if (target->path == NULL) {
+    target->fp = stdout;
+  } else {
+    target->fp = fopen(target->path, "w");
+    if (!target->fp) {
+      fprintf(stderr, "Failed to open output file: %s\n", target->path);
+      return 1;
     }
-    if (block->content != NULL) {
-      if (block->block != CODEBLOCK) {
-        escape_char_parsing(block->content);
-      }
-      if (block->block == CODEBLOCK) {
-        printf("<code>\n");
-      }
-      printf("%s\n", block->content);
-      if (block->block == CODEBLOCK) {
-        printf("</code>\n");
+    if (precompress_formats != 0 || write_etag) {
+      FILE *fp = precompress_output(target->fp, target->path,
+                                    precompress_formats, write_etag);
+      if (!fp) {
+        fclose(target->fp);
+        target->fp = NULL;
+        return 1;
       }
+      target->fp = fp;
+    }
+  }
+
+  if (stats_enabled) {
+    target->fp = stats_count_output(target->fp);
+  }
+  return 0;
+}
+
+static void close_output(OutputTarget *target) {
+  if (target->fp != NULL && target->fp != stdout) {
+    fclose(target->fp);
+  }
+  target->fp = NULL;
+}
+
+// write_rendered_output writes a body rendered ahead of time, wrapped the
+// same way generate_html wraps print_html
+static void write_rendered_output(OutputTarget *target, const MDBlock *head,
+                                  const RenderedBody *body,
+                                  const HtmlOptions *opts) {
+  if (target->fragment) {
+    write_rendered_body(target->fp, body);
+  } else if (head != NULL) {
+    write_html_head(target->fp, opts, head);
+    write_rendered_body(target->fp, body);
+    write_html_tail(target->fp, opts);
+  }
+}
+
+// convert_pipelined renders every output while the document is still being
+// read and block parsed, then closes the outputs
+static int convert_pipelined(FILE *md_file, OutputTarget *outputs,
+                             int output_count, const HtmlOptions *opts) {
+  PipelineOutput pipeline_outputs[MAX_OUTPUTS];
+  for (int i = 0; i < output_count; i++) {
+    pipeline_outputs[i] =
+        (PipelineOutput){.fp = outputs[i].fp, .fragment = outputs[i].fragment};
+  }
+
+  // The blocks are only needed afterwards to be profiled or logged, otherwise
+  // they are freed as soon as they are written
+  PipelineDocument *doc =
+      run_pipeline(md_file, pipeline_outputs, output_count, opts,
+                   mem_profile_enabled || debug_mode);
+  for (int i = 0; i < output_count; i++) {
+    close_output(&outputs[i]);
+  }
+  if (!doc) {
+    fprintf(stderr, "Failed to convert file\n");
+    return 1;
+  }
+
+  stats_set_input(doc->line_count, doc->size);
+  if (mem_profile_enabled) {
+    mem_profile_snapshot(doc->head, doc->refs, NULL);
+    mem_profile_source(doc->size, doc->segment_bytes);
+  }
+  // Blocks freed while rendering were counted by the pipeline
+  if (stats_enabled) {
+    stats_count_blocks(doc->head);
+  }
+
+  LOGF("\n=== Traverse block list ===\n");
+  traverse_block(doc->head);
+
+  free_pipeline_document(doc);
+  return 0;
+}
+
+// output_file_path maps input to a path under output_dir, keeping its
+// directories without leading "/", "./" or "../" and replacing the extension
+// with .html. Returns NULL on error.
+static char *output_file_path(const char *output_dir, const char *input) {
+  const char *rel = input;
+  for (;;) {
+    if (rel[0] == '/') {
+      rel++;
+    } else if (strncmp(rel, "./", 2) == 0) {
+      rel += 2;
+    } else if (strncmp(rel, "../", 3) == 0) {
+      rel += 3;
+    } else {
+      break;
     }
-    printf("</%s>\n", block->tag);
-  } else {
-    LOGF("Unknown block type: %d\n", block->type);
   }
 
-  print_html(block->next);
+  // A ".." further down could still leave output_dir, keep the file name only
+  const char *slash = strrchr(rel, '/');
+  const char *name = slash ? slash + 1 : rel;
+  if (strstr(rel, "/../") != NULL) {
+    rel = name;
+  }
+  const char *ext = strrchr(name, '.');
+  size_t stem_len = ext && ext != name ? (size_t)(ext - rel) : strlen(rel);
+  size_t len = strlen(output_dir) + 1 + stem_len + strlen(".html") + 1;
+  char *path = malloc(len);
+  if (!path) {
+    perror("malloc failed");
+    return NULL;
+  }
+  snprintf(path, len, "%s/%.*s.html", output_dir, (int)stem_len, rel);
+  return path;
 }
 
-int write_css(FILE *fp, const unsigned char *p, size_t n) {
-  size_t remaining = n;
+// make_parent_dirs creates the directories of path below output_dir. The
+// last directory made is remembered, files of one directory usually come
+// together.
+static int make_parent_dirs(char *path, size_t dir_len, char **last_dir) {
+  char *slash = strrchr(path, '/');
+  if (slash == NULL || (size_t)(slash - path) <= dir_len) {
+    return 0;
+  }
 
-  while (remaining > 0) {
-    size_t written = fwrite(p, 1, remaining, fp);
-    if (written == 0) {
+  *slash = '\0';
+  if (*last_dir != NULL && strcmp(*last_dir, path) == 0) {
+    *slash = '/';
+    return 0;
+  }
+  for (char *p = strchr(path + dir_len + 1, '/'); p != NULL;
+       p = strchr(p + 1, '/')) {
+    *p = '\0';
+    int err = mkdir(path, 0755) != 0 && errno != EEXIST ? errno : 0;
+    *p = '/';
+    if (err != 0) {
+      *slash = '/';
+      errno = err;
       return -1;
     }
-    p += written;
-    remaining -= written;
   }
+  if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+    *slash = '/';
+    return -1;
+  }
+  free(*last_dir);
+  *last_dir = strdup(path);
+  *slash = '/';
   return 0;
 }
 
-// write necessary html for highlight.js to run code highlighting
-// action: 0 = write src script tag, 1 = write execution script
-void write_highlight_js(FILE *fp, int action) {
-  if (action == 0) {
-    fprintf(fp, "<script "
-                "src=\"https://cdnjs.cloudflare.com/ajax/libs/highlight.js/"
-                "11.11.1/highlight.min.js\"></script>\n");
-  } else if (action == 1) {
-    fprintf(fp, "<script>hljs.highlightAll();</script>\n");
+// convert_buffer converts a whole input read into memory, returning its html
+// or NULL on error. The input data is taken over and its lines are added to
+// lines_in. With a cache, inline parsing must be deferred.
+static char *convert_buffer(BatchFile *input, bool fragment,
+                            const HtmlOptions *opts, BlockCache *cache,
+                            size_t *len, size_t *lines_in) {
+  MDSource *source = new_md_source_from_buffer(input->data, input->len);
+  input->data = NULL;
+  if (!source) {
+    return NULL;
+  }
+  *lines_in += source->line_count;
+
+  STATS_BEGIN(PHASE_REFERENCES);
+  MDLinkReference *link_ref_head = collect_link_references(NULL, source);
+  STATS_END();
+
+  MDBlock *head_block = NULL;
+  RenderedBody *body = NULL;
+  if (cache) {
+    STATS_BEGIN(PHASE_BLOCK);
+    body = render_blocks_cached(cache, source, link_ref_head, &head_block);
+    STATS_END();
+    if (!body) {
+      free_md_link_reference(link_ref_head);
+      free_md_source(source);
+      return NULL;
+    }
+  } else if (source->line_count > 0) {
+    PeekReader *reader =
+        new_peek_reader_from_source(source, DEFAULT_PEEK_COUNT);
+    if (!reader) {
+      fprintf(stderr, "Failed to create peek reader\n");
+      free_md_link_reference(link_ref_head);
+      free_md_source(source);
+      return NULL;
+    }
+    STATS_BEGIN(PHASE_BLOCK);
+    head_block = document_block_parsing(link_ref_head, reader);
+    STATS_END();
+    free_peek_reader(reader);
+  }
+  free_md_link_reference(link_ref_head);
+  if (stats_enabled) {
+    stats_count_blocks(head_block);
+  }
+
+  char *html = NULL;
+  STATS_BEGIN(PHASE_RENDER);
+  FILE *fp = open_memstream(&html, len);
+  if (!fp) {
+    perror("open_memstream failed");
+  } else {
+    if (body) {
+      OutputTarget target = {.fp = fp, .fragment = fragment};
+      write_rendered_output(&target, head_block, body, opts);
+    } else if (fragment) {
+      print_html(fp, head_block);
+    } else {
+      generate_html(fp, head_block, opts);
+    }
+    if (fclose(fp) != 0) {
+      perror("Failed to render file");
+      free(html);
+      html = NULL;
+    }
   }
+  STATS_END();
+
+  free_rendered_body(body);
+  free_mdblocks(head_block);
+  free_md_source(source);
+  return html;
 }
 
-// write html for theme toggler
-// action: 0 = write toggler UI, 1 = write toggler function script
-void write_theme_toggler(FILE *fp, int action) {
-  switch (action) {
-  case 0:
-    fprintf(fp, "<nav>\n");
-    fprintf(
-        fp,
-        "<svg xmlns=\"http://www.w3.org/2000/svg\" fill=\"none\" viewBox=\"0 "
-        "0 24 24\" stroke-width=\"1.5\" stroke=\"currentColor\" "
-        "class=\"toggle-theme light-theme\">\n");
-    fprintf(
-        fp,
-        "<path stroke-linecap=\"round\" stroke-linejoin=\"round\" d=\"M12 "
-        "3v2.25m6.364.386-1.591 1.591M21 12h-2.25m-.386 6.364-1.591-1.591M12 "
-        "18.75V21m-4.773-4.227-1.591 1.591M5.25 12H3m4.227-4.773L5.636 "
-        "5.636M15.75 12a3.75 3.75 0 1 1-7.5 0 3.75 3.75 0 0 1 7.5 0Z\" />\n");
-    fprintf(fp, "</svg>\n");
-    fprintf(
-        fp,
-        "<svg xmlns=\"http://www.w3.org/2000/svg\" fill=\"none\" viewBox=\"0 "
-        "0 24 24\" stroke-width=\"1.5\" stroke=\"currentColor\" "
-        "class=\"toggle-theme dark-theme\">\n");
-    fprintf(
-        fp,
-        "<path stroke-linecap=\"round\" stroke-linejoin=\"round\" d=\"M21.752 "
-        "15.002A9.72 9.72 0 0 1 18 15.75c-5.385 0-9.75-4.365-9.75-9.75 "
-        "0-1.33.266-2.597.748-3.752A9.753 9.753 0 0 0 3 11.25C3 16.635 7.365 "
-        "21 12.75 21a9.753 9.753 0 0 0 9.002-5.998Z\" />\n");
-    fprintf(fp, "</svg>\n");
-    fprintf(fp, "</nav>\n");
-    break;
-  case 1:
-    fprintf(fp, "<script>\n");
-    fprintf(fp, "(function () {\n");
-    fprintf(fp, "const saved = localStorage.getItem('theme');\n");
-    fprintf(fp, "const prefersDark = window.matchMedia('(prefers-color-scheme: "
-                "light)').matches;\n");
-    fprintf(fp, "const theme = saved || (prefersDark ? 'light' : 'dark');\n");
-    fprintf(fp,
-            "document.body.classList.toggle('light', theme === 'light');\n");
-    fprintf(fp, "document.documentElement.dataset.theme = theme;\n");
-    fprintf(fp, "document.documentElement.style.colorScheme = theme;\n");
-    fprintf(fp,
-            "const lightThemeBtn = document.querySelector('.light-theme');\n");
-    fprintf(fp,
-            "const darkThemeBtn = document.querySelector('.dark-theme');\n");
-    fprintf(fp, "if (theme === 'light') {\n");
-    fprintf(fp, "lightThemeBtn.classList.add('hidden');\n");
-    fprintf(fp, "darkThemeBtn.classList.remove('hidden');\n");
-    fprintf(fp, "} else {\n");
-    fprintf(fp, "darkThemeBtn.classList.add('hidden');\n");
-    fprintf(fp, "lightThemeBtn.classList.remove('hidden');\n");
-    fprintf(fp, "}\n");
-    fprintf(fp, "})();\n");
-    fprintf(fp, "</script>\n");
-    fprintf(fp, "<script>\n");
-    fprintf(fp, "const themes = document.querySelectorAll('.toggle-theme');\n");
-    fprintf(fp, "themes.forEach(theme => {\n");
-    fprintf(fp, "theme.addEventListener('click', () => {\n");
-    fprintf(fp, "const current = document.body.classList.contains('light') ? "
-                "'light' : 'dark';\n");
-    fprintf(fp, "const next = current === 'light' ? 'dark' : 'light';\n");
-    fprintf(fp, "localStorage.setItem('theme', next);\n");
-    fprintf(fp, "document.documentElement.dataset.theme = theme;\n");
-    fprintf(fp, "document.documentElement.style.colorScheme = theme;\n");
-    fprintf(fp, "document.body.classList.toggle('light');\n");
-    fprintf(fp, "themes.forEach(t => t.classList.toggle('hidden'));\n");
-    fprintf(fp, "});\n");
-    fprintf(fp, "});\n");
-    fprintf(fp, "</script>\n");
-    break;
-  default:
-    perror("Invalid action for write_theme_toggler");
+// convert_files converts every input argument into output_dir, reading and
+// then writing the files a batch at a time
+static int convert_files(int argc, char *argv[], const char *output_dir,
+                         bool use_io_uring, bool fragment,
+                         const HtmlOptions *opts, BlockCache *cache) {
+  if (mkdir(output_dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Failed to create output directory: %s: %s\n",
+            output_dir, strerror(errno));
+    return 1;
+  }
+  BatchIO *io = new_batch_io(use_io_uring);
+  if (!io) {
+    return 1;
+  }
+  LOGF("Batch file I/O through %s\n",
+       batch_io_uses_uring(io) ? "io_uring" : "read and write");
+
+  BatchFile inputs[BATCH_IO_DEPTH];
+  BatchFile outputs[BATCH_IO_DEPTH];
+  char *last_dir = NULL;
+  size_t dir_len = strlen(output_dir);
+  size_t lines_in = 0;
+  size_t bytes_in = 0;
+  int status = 0;
+  for (int arg = 1; arg < argc;) {
+    size_t count = 0;
+    for (; arg < argc && count < BATCH_IO_DEPTH; arg++) {
+      if (strncmp(argv[arg], "--", 2) != 0) {
+        inputs[count++].path = argv[arg];
+      }
+    }
+    if (count == 0) {
+      break;
+    }
+
+    STATS_BEGIN(PHASE_READ);
+    TRACE_BEGIN("read_batch");
+    batch_io_read(io, inputs, count);
+    TRACE_END("read_batch");
+    STATS_END();
+
+    size_t written = 0;
+    for (size_t i = 0; i < count; i++) {
+      BatchFile *input = &inputs[i];
+      if (input->error != 0) {
+        fprintf(stderr, "Failed to read file: %s: %s\n", input->path,
+                strerror(input->error));
+        status = 1;
+        continue;
+      }
+      bytes_in += input->len;
+
+      BatchFile *output = &outputs[written];
+      char *path = output_file_path(output_dir, input->path);
+      if (!path) {
+        free(input->data);
+        status = 1;
+        continue;
+      }
+      if (make_parent_dirs(path, dir_len, &last_dir) != 0) {
+        fprintf(stderr, "Failed to create output directory for: %s: %s\n",
+                path, strerror(errno));
+        free(input->data);
+        free(path);
+        status = 1;
+        continue;
+      }
+
+      // Pages in subdirectories link to the theme files through "../"
+      HtmlOptions page_opts = *opts;
+      for (const char *p = path + dir_len + 1; (p = strchr(p, '/')) != NULL;
+           p++) {
+        page_opts.asset_depth++;
+      }
+
+      TRACE_BEGIN("convert_file");
+      char *html = convert_buffer(input, fragment, &page_opts, cache,
+                                  &output->len, &lines_in);
+      TRACE_END("convert_file");
+      if (!html) {
+        fprintf(stderr, "Failed to convert file: %s\n", input->path);
+        free(path);
+        status = 1;
+        continue;
+      }
+      output->path = path;
+      output->data = html;
+      written++;
+    }
+
+    TRACE_BEGIN("write_batch");
+    batch_io_write(io, outputs, written);
+    TRACE_END("write_batch");
+    for (size_t i = 0; i < written; i++) {
+      if (outputs[i].error != 0) {
+        fprintf(stderr, "Failed to write file: %s: %s\n", outputs[i].path,
+                strerror(outputs[i].error));
+        status = 1;
+      } else {
+        stats_count_output_bytes(outputs[i].len);
+        // The page is still in memory, its copies take no second read
+        if ((precompress_formats != 0 || write_etag) &&
+            precompress_buffer(outputs[i].path, outputs[i].data,
+                               outputs[i].len, precompress_formats,
+                               write_etag) != 0) {
+          status = 1;
+        }
+      }
+      free((char *)outputs[i].path);
+      free(outputs[i].data);
+    }
+  }
+
+  stats_set_input(lines_in, bytes_in);
+  free(last_dir);
+  free_batch_io(io);
+  return status;
+}
+
+// write_page_assets writes the shared theme files into output_dir, or next to
+// output_path, for the pages to link to. Returns 0 on success, 1 on error.
+static int write_page_assets(const char *output_dir, const char *output_path,
+                             HtmlOptions *opts) {
+  if (output_dir != NULL) {
+    return write_theme_assets(output_dir, opts) != 0;
+  }
+  if (output_path == NULL) {
+    fprintf(stderr, "--external-assets requires --output or --output-dir\n");
+    return 1;
+  }
+
+  char *dir = strdup(output_path);
+  if (!dir) {
+    perror("strdup failed");
+    return 1;
+  }
+  char *slash = strrchr(dir, '/');
+  if (slash == dir) {
+    slash[1] = '\0';
+  } else if (slash != NULL) {
+    *slash = '\0';
   }
+  int status = write_theme_assets(slash ? dir : ".", opts) != 0;
+  free(dir);
+  return status;
 }
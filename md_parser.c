@@ -7,27 +7,50 @@
 #include "file_reader.h"
 #include "md_parser.h"
 #include "md_regex.h"
+#include "mem_profile.h"
+#include "stats.h"
 #include "str_utils.h"
+#include "trace.h"
 
 static const int INDENT_SIZE = 4;
 
+static char *join_lazy_line(const char *segment, const char *line);
+
 const int parsers_count = 11;
-Parsers parsers[] = {{heading_parser, 0},      {blockquote_parser, 1},
-                     {ordered_list_parser, 1}, {unordered_list_parser, 1},
-                     {codeblock_parser, 1},    {horizontal_line_parser, 0},
-                     {plain_parser, 0},        {link_reference_parser, 0},
-                     {html_tag_parser, 1},     {paragraph_parser, 1},
-                     {section_break_parser, 0}};
+Parsers parsers[] = {
+    {heading_parser, 0, "heading"},
+    {blockquote_parser, 1, "blockquote"},
+    {ordered_list_parser, 1, "ordered_list"},
+    {unordered_list_parser, 1, "unordered_list"},
+    {codeblock_parser, 1, "codeblock"},
+    {horizontal_line_parser, 0, "horizontal_line"},
+    {plain_parser, 0, "plain"},
+    {link_reference_parser, 0, "link_reference"},
+    {html_tag_parser, 1, "html_tag"},
+    {paragraph_parser, 1, "paragraph"},
+    {section_break_parser, 0, "section_break"}};
+
+// A continued span is a line appended to the current multiline block
+static void trace_block_parsing_end(const char *parser, int probed,
+                                    bool continued) {
+  if (trace_enabled) {
+    trace_end("block_parsing",
+              "\"parser\": \"%s\", \"probed\": %d, \"continued\": %s",
+              parser, probed, continued ? "true" : "false");
+  }
+}
 
 MDBlock *block_parsing(MDBlock *prnt_block, MDBlock *curr_block,
                        PeekReader *reader, MDLinkReference *link_ref_head) {
   LOGF("parsing block: %s\n", peek_reader_current(reader));
+  TRACE_BEGIN("block_parsing");
   MDBlock *new_block = NULL;
 
   for (int i = 0; i < parsers_count; i++) {
     new_block = parsers[i].parser(prnt_block, curr_block, reader);
     if (parsers[i].multiline) {
       if (new_block != NULL && new_block == curr_block) {
+        trace_block_parsing_end(parsers[i].name, i + 1, true);
         return NULL;
       }
     }
@@ -35,40 +58,25 @@ MDBlock *block_parsing(MDBlock *prnt_block, MDBlock *curr_block,
       if (new_block != curr_block && curr_block != NULL) {
         child_parsing_exec(link_ref_head, curr_block);
       }
+      trace_block_parsing_end(parsers[i].name, i + 1, false);
       return new_block;
     }
   }
 
+  trace_block_parsing_end("none", parsers_count, false);
   return NULL;
 }
 
-MDBlock *content_block_parsing(MDBlock *prnt_block, MDBlock *curr_block,
-                               PeekReader *reader,
-                               MDLinkReference *link_ref_head) {
-  MDBlock *new_block = list_item_parser(prnt_block, curr_block, reader);
-  if (new_block != NULL) {
-    inline_parsing(link_ref_head, new_block);
-    // printf("list item block content: %s\n", new_block->content);
-    if (strchr(new_block->content, '\n') != NULL) {
-      LOGF("parse list item child block\n");
-      new_block->child = child_block_parsing(link_ref_head, new_block);
-    }
-    // printf("return list item block\n");
-    return new_block;
-  }
-
-  new_block = block_parsing(prnt_block, curr_block, reader, link_ref_head);
-  return new_block;
-}
-
 void child_parsing_exec(MDLinkReference *head, MDBlock *block) {
   if (block) {
     switch (block->block) {
     case BLOCKQUOTE:
     case ORDERED_LIST:
     case UNORDERED_LIST:
-      if (block->child == NULL) {
+      if (block->child == NULL && block->lines != NULL) {
+        STATS_BEGIN(PHASE_CHILD);
         block->child = child_block_parsing(head, block);
+        STATS_END();
       }
       break;
     default:
@@ -77,33 +85,23 @@ void child_parsing_exec(MDLinkReference *head, MDBlock *block) {
   }
 }
 
-MDBlock *child_block_parsing(MDLinkReference *link_ref_head,
-                             MDBlock *prnt_block) {
-  LOGF("child block parsing content:\n%s\n", prnt_block->content);
+// document_block_parsing parses the top level blocks of reader until it is
+// exhausted, every block is child and inline parsed once it is complete.
+MDBlock *document_block_parsing(MDLinkReference *link_ref_head,
+                                PeekReader *reader) {
   MDBlock *head_block = NULL;
   MDBlock *tail_block = head_block;
   MDBlock *new_block = NULL;
 
-  int line_count = 0;
-  char **lines = content_splitter(prnt_block->content, '\n', &line_count);
-  if (lines == NULL) {
-    perror("content_splitter failed");
-    return NULL;
-  }
-
-  PeekReader *reader =
-      new_peek_reader_from_lines(lines, line_count, DEFAULT_PEEK_COUNT);
-  if (!reader) {
-    return NULL;
-  }
-
   do {
-    new_block =
-        content_block_parsing(prnt_block, tail_block, reader, link_ref_head);
+    new_block = block_parsing(NULL, tail_block, reader, link_ref_head);
+
     if (new_block != NULL) {
-      if (new_block == tail_block) {
-        continue;
-      }
+      LOGF("block: %d, content: %s\n", new_block->block, new_block->content);
+
+      child_parsing_exec(link_ref_head, tail_block);
+      inline_parsing(link_ref_head, tail_block);
+
       if (head_block == NULL) {
         head_block = new_block;
         tail_block = head_block;
@@ -113,7 +111,6 @@ MDBlock *child_block_parsing(MDLinkReference *link_ref_head,
       }
     }
   } while (reader->count > 0);
-  free_peek_reader(reader);
 
   child_parsing_exec(link_ref_head, tail_block);
   inline_parsing(link_ref_head, tail_block);
@@ -121,7 +118,163 @@ MDBlock *child_block_parsing(MDLinkReference *link_ref_head,
   return head_block;
 }
 
+// Container block whose lines are being parsed into its children
+typedef struct {
+  MDBlock *block;
+  PeekReader *reader;
+  MDBlock *head;
+  MDBlock *tail;
+} ContainerFrame;
+
+// Open containers from the outermost one, the innermost one is parsed next
+typedef struct {
+  ContainerFrame *frames;
+  int depth;
+  int capacity;
+} ContainerStack;
+
+static bool is_open_container(const MDBlock *block) {
+  switch (block->block) {
+  case BLOCKQUOTE:
+  case ORDERED_LIST:
+  case UNORDERED_LIST:
+  case LIST_ITEM:
+    return block->lines != NULL && block->child == NULL;
+  default:
+    return false;
+  }
+}
+
+static int push_container(ContainerStack *stack, MDBlock *block) {
+  if (stack->depth == stack->capacity) {
+    int capacity = stack->capacity ? stack->capacity * 2 : 8;
+    ContainerFrame *frames =
+        realloc(stack->frames, capacity * sizeof(ContainerFrame));
+    if (!frames) {
+      perror("Unable to reallocate container stack");
+      return -1;
+    }
+    stack->frames = frames;
+    stack->capacity = capacity;
+  }
+
+  LOGF("child block parsing %d lines\n", block->lines->count);
+  PeekReader *reader = new_peek_reader_from_line_views(
+      block->lines->lines, block->lines->count, DEFAULT_PEEK_COUNT);
+  if (!reader) {
+    return -1;
+  }
+  TRACE_BEGIN("child_block_parsing");
+  stack->frames[stack->depth++] =
+      (ContainerFrame){.block = block, .reader = reader};
+  return 0;
+}
+
+// pop_container ends the innermost container and returns its children. Its
+// lines are released unless a child may still point into a joined line.
+static MDBlock *pop_container(ContainerStack *stack,
+                              MDLinkReference *link_ref_head) {
+  ContainerFrame *frame = &stack->frames[--stack->depth];
+  free_peek_reader(frame->reader);
+  inline_parsing(link_ref_head, frame->tail);
+
+  LineList *lines = frame->block->lines;
+  if (trace_enabled) {
+    trace_end("child_block_parsing", "\"block\": \"%s\", \"lines\": %d",
+              blocktag_to_string(frame->block->block), lines->count);
+  }
+  bool owned = false;
+  for (int i = 0; i < lines->count && !owned; i++) {
+    owned = lines->owned[i];
+  }
+  if (!owned) {
+    free_line_list(lines);
+    frame->block->lines = NULL;
+  }
+  return frame->head;
+}
+
+// child_block_parsing parses the lines of a container block in place, every
+// child block is inline parsed once it is complete. Nested containers are
+// kept on a stack instead of recursing, a container is parsed as soon as it
+// is complete and its parent goes on after it.
+MDBlock *child_block_parsing(MDLinkReference *link_ref_head,
+                             MDBlock *prnt_block) {
+  if (prnt_block->lines == NULL) {
+    return NULL;
+  }
+
+  ContainerStack stack = {0};
+  if (push_container(&stack, prnt_block) != 0) {
+    free(stack.frames);
+    return NULL;
+  }
+
+  MDBlock *head_block = NULL;
+  while (stack.depth > 0) {
+    ContainerFrame *frame = &stack.frames[stack.depth - 1];
+    if (frame->reader->count == 0) {
+      MDBlock *block = frame->block;
+      MDBlock *children = pop_container(&stack, link_ref_head);
+      if (stack.depth == 0) {
+        head_block = children;
+      } else {
+        block->child = children;
+      }
+      continue;
+    }
+
+    MDBlock *new_block =
+        list_item_parser(frame->block, frame->tail, frame->reader);
+    if (new_block == NULL) {
+      new_block = block_parsing(frame->block, frame->tail, frame->reader,
+                                link_ref_head);
+    }
+    if (new_block == NULL) {
+      continue;
+    }
+
+    if (frame->head == NULL) {
+      frame->head = new_block;
+    } else {
+      inline_parsing(link_ref_head, frame->tail);
+      frame->tail->next = new_block;
+    }
+    frame->tail = new_block;
+
+    // A container left without children on error is written empty
+    if (is_open_container(new_block)) {
+      push_container(&stack, new_block);
+    }
+  }
+  free(stack.frames);
+
+  return head_block;
+}
+
+bool defer_inline_parsing = false;
+
+static void inline_parse_block(MDLinkReference *list, MDBlock *block);
+
+// inline_parsing converts the inline markdown of a finished block, unless
+// it is deferred to inline_parsing_tree once the whole tree is built.
 void inline_parsing(MDLinkReference *list, MDBlock *block) {
+  if (!defer_inline_parsing) {
+    inline_parse_block(list, block);
+  }
+}
+
+// inline_parsing_tree inline parses block and all its descendants, but not
+// the blocks following it. The link references are only read, so disjoint
+// blocks can be parsed from several threads.
+void inline_parsing_tree(MDLinkReference *list, MDBlock *block) {
+  inline_parse_block(list, block);
+  for (MDBlock *child = block->child; child != NULL; child = child->next) {
+    inline_parsing_tree(list, child);
+  }
+}
+
+static void inline_parse_block(MDLinkReference *list, MDBlock *block) {
   if (block == NULL || block->content == NULL) {
     return;
   }
@@ -131,10 +284,18 @@ void inline_parsing(MDLinkReference *list, MDBlock *block) {
     return;
   }
 
+  STATS_BEGIN(PHASE_INLINE);
+  TRACE_BEGIN("inline_parsing");
+  if (mem_profile_enabled) {
+    mem_profile_inline_begin();
+  }
   char *content = block->content;
   LOGF("inline origin content: %s\n", content);
+  TRACE_BEGIN("emphasis");
   char *emphasis_content = emphasis_parser(content);
-  LOGF("inline emphasis content: %s\n", emphasis_content);
+  TRACE_END("emphasis");
+  LOGF("inline emphasis content: %s\n",
+       emphasis_content ? emphasis_content : "(none)");
   if (emphasis_content != NULL) {
     // free(NULL) is safe in C and does nothing
     free(block->content);
@@ -142,7 +303,15 @@ void inline_parsing(MDLinkReference *list, MDBlock *block) {
     LOGF("replace content\n");
   }
 
-  char *image_content = image_parser(block->content);
+  // Code spans only come from the emphasis stage, find them once for all the
+  // image and link scans below
+  TRACE_BEGIN("code_spans");
+  MDSpanList *code_spans = find_code_spans(block->content);
+  TRACE_END("code_spans");
+
+  TRACE_BEGIN("image");
+  char *image_content = image_parser(block->content, code_spans);
+  TRACE_END("image");
   LOGF("inline image content: %s\n", image_content);
   if (image_content != NULL && image_content != block->content) {
     if (block->content) {
@@ -151,7 +320,10 @@ void inline_parsing(MDLinkReference *list, MDBlock *block) {
     block->content = image_content;
   }
 
-  char *link_content = link_parser(list, block->content);
+  TRACE_BEGIN("link");
+  char *link_content = link_parser(list, block->content, code_spans);
+  TRACE_END("link");
+  free_code_spans(code_spans);
   LOGF("inline link content: %s\n", link_content);
   if (link_content != NULL && link_content != block->content) {
     if (block->content) {
@@ -161,31 +333,14 @@ void inline_parsing(MDLinkReference *list, MDBlock *block) {
   }
 
   LOGF("block content after inline parsing: %s\n", block->content);
-
-  return;
-}
-
-// escape_char_parsing is used to remove escape '\' from escape characters of
-// the given string. The string is modified in place.
-void escape_char_parsing(char *str) {
-  if (str == NULL) {
-    return;
+  if (trace_enabled) {
+    trace_end("inline_parsing", "\"block\": \"%s\", \"bytes\": %zu",
+              blocktag_to_string(block->block), strlen(block->content));
   }
-
-  int len = strlen(str);
-  for (int i = 0; i < len - 1; i++) {
-    if (str[i] == '\\') {
-      // Check if the next character is a special character
-      if (strchr("\\`*_{}[]<>()#+-.!|", str[i + 1]) != NULL) {
-        // Shift the rest of the string left by one character
-        memmove(&str[i], &str[i + 1], len - i);
-        len--;
-        str[len] = '\0'; // Null-terminate the string
-      }
-    }
+  if (mem_profile_enabled) {
+    mem_profile_inline_end();
   }
-
-  // printf("escape_char_parsing result: %s\n", str);
+  STATS_END();
 }
 
 MDBlock *heading_parser(MDBlock *prnt_block, MDBlock *curr_block,
@@ -215,6 +370,9 @@ MDBlock *heading_parser(MDBlock *prnt_block, MDBlock *curr_block,
 
   MDBlock *new_block = new_mdblock(line_ptr, tag, level, BLOCK, 0);
   free(tag);
+  if (new_block != NULL) {
+    trim_space_inplace(new_block->content);
+  }
 
   for (int i = 0; i < advanced_count; i++) {
     if (!peek_reader_advance(reader)) {
@@ -243,22 +401,18 @@ MDBlock *html_tag_parser(MDBlock *prnt_block, MDBlock *curr_block,
       break;
     }
 
-    if (new_block != NULL) {
-      mdblock_content_update(new_block, line, "%s%s\n");
-    } else {
+    if (new_block == NULL) {
       LOGF("new html tag block: %s\n", line);
-      new_block = new_mdblock(line, "", HTML_TAG, NONE, 1);
+      new_block = new_verbatim_block("", HTML_TAG, NONE);
+      if (new_block == NULL) {
+        return NULL;
+      }
     }
+    line_list_push(new_block->lines, line, false);
 
     peek_reader_advance(reader);
   }
 
-  if (new_block->content != NULL) {
-    size_t len = strlen(new_block->content);
-    if (len > 0 && new_block->content[len - 1] == '\n') {
-      new_block->content[len - 1] = '\0';
-    }
-  }
   return new_block;
 }
 
@@ -311,10 +465,12 @@ MDBlock *blockquote_parser(MDBlock *prnt_block, MDBlock *curr_block,
     }
 
     if (new_block == NULL) {
-      new_block = new_mdblock(line, "blockquote", BLOCKQUOTE, BLOCK, 1);
-    } else if (new_block != NULL) {
-      mdblock_content_update(new_block, line, "%s%s\n");
+      new_block = new_container_block("blockquote", BLOCKQUOTE);
+      if (new_block == NULL) {
+        return NULL;
+      }
     }
+    line_list_push(new_block->lines, line, false);
 
     peek_reader_advance(reader);
     if (!is_blockquote_syntax(next_line)) {
@@ -337,13 +493,16 @@ MDBlock *ordered_list_parser(MDBlock *prnt_block, MDBlock *curr_block,
       break;
     }
 
-    if (new_block != NULL) {
-      mdblock_content_update(new_block, line, "%s%s\n");
-    } else if (is_ordered_list_syntax(line, 1)) {
-      new_block = new_mdblock(line, "ol", ORDERED_LIST, BLOCK, 1);
-    } else {
-      break;
+    if (new_block == NULL) {
+      if (!is_ordered_list_syntax(line, 1)) {
+        break;
+      }
+      new_block = new_container_block("ol", ORDERED_LIST);
+      if (new_block == NULL) {
+        return NULL;
+      }
     }
+    line_list_push(new_block->lines, line, false);
 
     peek_reader_advance(reader);
     if (!safe_ordered_list_content(reader, 0)) {
@@ -367,13 +526,16 @@ MDBlock *unordered_list_parser(MDBlock *prnt_block, MDBlock *curr_block,
       break;
     }
 
-    if (new_block != NULL) {
-      mdblock_content_update(new_block, line, "%s%s\n");
-    } else if (is_unordered_list_syntax(line)) {
-      new_block = new_mdblock(line, "ul", UNORDERED_LIST, BLOCK, 1);
-    } else {
-      break;
+    if (new_block == NULL) {
+      if (!is_unordered_list_syntax(line)) {
+        break;
+      }
+      new_block = new_container_block("ul", UNORDERED_LIST);
+      if (new_block == NULL) {
+        return NULL;
+      }
     }
+    line_list_push(new_block->lines, line, false);
 
     peek_reader_advance(reader);
     if (!safe_unordered_list_content(reader, 0)) {
@@ -384,56 +546,92 @@ MDBlock *unordered_list_parser(MDBlock *prnt_block, MDBlock *curr_block,
   return new_block;
 }
 
+// list_item_parser parses a list item starting at the current line. Lazy
+// continuation lines are joined to the item text with a space. Once an
+// indented line shows up, the item becomes a container: every indented line
+// starts a new segment which is parsed into the item's child blocks.
 MDBlock *list_item_parser(MDBlock *prnt_block, MDBlock *prev_block,
                           PeekReader *reader) {
   (void)prev_block; // Unused parameter
 
-  MDBlock *new_block = NULL;
+  char *line = peek_reader_current(reader);
+  if (is_empty_or_whitespace(line) || prnt_block == NULL) {
+    return NULL;
+  }
+
+  int offset = 0;
+  switch (prnt_block->block) {
+  case ORDERED_LIST:
+    offset = is_ordered_list_syntax(line, 0);
+    break;
+  case UNORDERED_LIST:
+    offset = is_unordered_list_syntax(line);
+    break;
+  default:
+    offset = 0;
+  }
+  if (!offset) {
+    return NULL;
+  }
+
+  LineList *segments = NULL;
+  char *segment = line + offset;
+  bool segment_owned = false;
+
   while (true) {
-    char *line = peek_reader_current(reader);
     char *next_line = peek_reader_peek(reader, 1);
-    // printf("list item parsing: %s\n", line);
-    // printf("parent block: %d\n", prnt_block->block);
-
-    if (is_empty_or_whitespace(line) || prnt_block == NULL) {
-      return NULL;
+    peek_reader_advance(reader);
+    if (!safe_paragraph_content(reader, 0) &&
+        !is_indented_line(INDENT_SIZE, next_line)) {
+      break;
     }
 
-    int offset = 0;
-    switch (prnt_block->block) {
-    case ORDERED_LIST:
-      offset = is_ordered_list_syntax(line, 0);
-      break;
-    case UNORDERED_LIST:
-      offset = is_unordered_list_syntax(line);
+    line = peek_reader_current(reader);
+    if (is_empty_or_whitespace(line)) {
       break;
-    default:
-      offset = 0;
-      if (new_block == NULL) {
-        return NULL;
-      }
     }
 
-    // printf("list item offset: %d\n", offset);
-    if (!offset && new_block != NULL) {
-      if (is_indented_line(INDENT_SIZE, line)) {
-        char *line_ptr = line + INDENT_SIZE;
-        mdblock_content_update(new_block, line_ptr, "%s\n%s");
-      } else {
-        mdblock_content_update(new_block, line, "%s %s");
+    if (is_indented_line(INDENT_SIZE, line)) {
+      if (segments == NULL) {
+        segments = calloc(1, sizeof(LineList));
+        if (segments == NULL) {
+          perror("calloc failed");
+          break;
+        }
       }
-    } else if (offset) {
-      char *line_ptr = line + offset;
-      // printf("new list item block\n");
-      new_block = new_mdblock(line_ptr, "li", LIST_ITEM, BLOCK, 0);
+      line_list_push(segments, segment, segment_owned);
+      segment = line + INDENT_SIZE;
+      segment_owned = false;
+    } else {
+      char *joined = join_lazy_line(segment, line);
+      if (joined == NULL) {
+        break;
+      }
+      if (segment_owned) {
+        free(segment);
+      }
+      segment = joined;
+      segment_owned = true;
     }
+  }
 
-    peek_reader_advance(reader);
-    if (!safe_paragraph_content(reader, 0) &&
-        !is_indented_line(INDENT_SIZE, next_line)) {
-      break;
+  MDBlock *new_block = NULL;
+  if (segments == NULL) {
+    new_block = new_mdblock(segment, "li", LIST_ITEM, BLOCK, 0);
+    if (segment_owned) {
+      free(segment);
     }
+    return new_block;
+  }
+
+  line_list_push(segments, segment, segment_owned);
+  new_block = new_container_block("li", LIST_ITEM);
+  if (new_block == NULL) {
+    free_line_list(segments);
+    return NULL;
   }
+  free_line_list(new_block->lines);
+  new_block->lines = segments;
 
   return new_block;
 }
@@ -462,11 +660,13 @@ MDBlock *codeblock_parser(MDBlock *prnt_block, MDBlock *curr_block,
       break;
     }
 
-    if (new_block != NULL) {
-      mdblock_content_update(new_block, line, "%s\n%s");
-    } else {
-      new_block = new_mdblock(line, "pre", CODEBLOCK, BLOCK, 0);
+    if (new_block == NULL) {
+      new_block = new_verbatim_block("pre", CODEBLOCK, BLOCK);
+      if (new_block == NULL) {
+        return NULL;
+      }
     }
+    line_list_push(new_block->lines, line, false);
 
     peek_reader_advance(reader);
     if (!is_indented_line(INDENT_SIZE, next_line) &&
@@ -516,15 +716,21 @@ MDBlock *link_reference_parser(MDBlock *prnt_block, MDBlock *curr_block,
     return NULL;
   }
 
-  MDLinkReference *ref = parse_markdown_links_reference(line);
-  if (ref == NULL) {
+  // Source lines were already matched by the reference pass
+  int known = peek_reader_reference_line(reader);
+  if (known == 0) {
     return NULL;
   }
+  if (known < 0) {
+    MDLinkReference *ref = parse_markdown_links_reference(line);
+    if (ref == NULL) {
+      return NULL;
+    }
+    free_md_link_reference(ref);
+  }
 
   MDBlock *new_block = new_mdblock(line, NULL, LINK_REFERENCE, NONE, 0);
 
-  free_md_link_reference(ref);
-
   peek_reader_advance(reader);
   return new_block;
 }
@@ -605,12 +811,106 @@ MDBlock *new_mdblock(char *content, char *html_tag, BlockTag block_tag,
   block->tag = html_tag ? strdup(html_tag) : NULL;
   block->block = block_tag;
   block->type = type;
+  block->lines = NULL;
   block->child = NULL;
   block->next = NULL;
 
   return block;
 }
 
+// new_container_block creates a block without content whose lines are
+// collected until its children are parsed.
+MDBlock *new_container_block(char *html_tag, BlockTag block_tag) {
+  MDBlock *block = new_mdblock(NULL, html_tag, block_tag, BLOCK, 0);
+  if (block == NULL) {
+    return NULL;
+  }
+
+  block->lines = calloc(1, sizeof(LineList));
+  if (block->lines == NULL) {
+    perror("calloc failed");
+    free_mdblocks(block);
+    return NULL;
+  }
+
+  return block;
+}
+
+// new_verbatim_block creates a code or raw html block whose lines are written
+// out as they are, without being copied into content. The lines pushed must
+// stay valid until the block is rendered.
+MDBlock *new_verbatim_block(char *html_tag, BlockTag block_tag, TagType type) {
+  MDBlock *block = new_container_block(html_tag, block_tag);
+  if (block != NULL) {
+    block->type = type;
+  }
+  return block;
+}
+
+int line_list_push(LineList *cl, char *line, bool owned) {
+  if (cl->count == cl->capacity) {
+    int capacity = cl->capacity ? cl->capacity * 2 : 8;
+    char **lines = realloc(cl->lines, capacity * sizeof(char *));
+    if (!lines) {
+      perror("Unable to reallocate container lines");
+      return -1;
+    }
+    cl->lines = lines;
+
+    bool *owned_flags = realloc(cl->owned, capacity * sizeof(bool));
+    if (!owned_flags) {
+      perror("Unable to reallocate container lines");
+      return -1;
+    }
+    cl->owned = owned_flags;
+    cl->capacity = capacity;
+  }
+
+  cl->lines[cl->count] = line;
+  cl->owned[cl->count] = owned;
+  cl->count++;
+  return 0;
+}
+
+void free_line_list(LineList *cl) {
+  if (cl == NULL) {
+    return;
+  }
+
+  for (int i = 0; i < cl->count; i++) {
+    if (cl->owned[i]) {
+      free(cl->lines[i]);
+    }
+  }
+  free(cl->lines);
+  free(cl->owned);
+  free(cl);
+}
+
+// join_lazy_line returns a new string of segment and line joined by a space,
+// the same way paragraph continuation lines are joined.
+static char *join_lazy_line(const char *segment, const char *line) {
+  char *parsed_segment = line_break_parser(segment);
+  if (parsed_segment != NULL) {
+    segment = parsed_segment;
+  }
+  char *parsed_line = line_break_parser(line);
+  if (parsed_line != NULL) {
+    line = parsed_line;
+  }
+
+  char *joined = malloc(strlen(segment) + strlen(line) + 2);
+  if (joined) {
+    sprintf(joined, "%s %s", segment, line);
+  } else {
+    perror("malloc failed");
+  }
+  free(parsed_segment);
+  free(parsed_line);
+
+  return joined;
+}
+
 char *line_break_parser(const char *line) {
   if (line == NULL) {
     return NULL;
@@ -660,14 +960,15 @@ char *emphasis_parser(char *str) {
   return result;
 }
 
-char *link_parser(MDLinkReference *list, char *str) {
+char *link_parser(MDLinkReference *list, char *str,
+                  const MDSpanList *code_spans) {
   LOGF("enter link_parser with str: %s\n", str);
   if (str == NULL) {
     return NULL;
   }
 
   size_t count = 0;
-  MDLinkRegex *links = parse_markdown_links(list, str, &count);
+  MDLinkRegex *links = parse_markdown_links(list, str, code_spans, &count);
 
   if (links == NULL || count == 0) {
     free_md_links(links, count);
@@ -739,13 +1040,13 @@ char *link_parser(MDLinkReference *list, char *str) {
   return dup_str;
 }
 
-char *image_parser(char *str) {
+char *image_parser(char *str, MDSpanList *code_spans) {
   if (str == NULL) {
     return NULL;
   }
 
   size_t count = 0;
-  MDLinkRegex *images = parse_markdown_images(str, &count);
+  MDLinkRegex *images = parse_markdown_images(str, code_spans, &count);
 
   if (images == NULL || count == 0) {
     free_md_links(images, count);
@@ -801,6 +1102,7 @@ char *image_parser(char *str) {
     tmp_str[tmp_len] = '\0'; // Null-terminate the string
 
     offset += strlen(sub_str) - (image->end - image->start);
+    shift_code_spans(code_spans, image->start, image->end, strlen(sub_str));
     free(dup_str);
     free(sub_str);
     dup_str = tmp_str; // Update str to the new string with image replaced
@@ -1132,19 +1434,20 @@ bool safe_unordered_list_content(PeekReader *reader, int peek) {
 void mdblock_content_update(MDBlock *block, char *content, char *formatter) {
   char *parsed_line = line_break_parser(content);
   if (parsed_line != NULL) {
-    free(block->content);
-    block->content = parsed_line;
+    content = parsed_line;
   }
 
   size_t len = strlen(block->content) + strlen(content) + 2;
   char *paragraph = malloc(len);
   if (!paragraph) {
     perror("malloc failed");
+    free(parsed_line);
     return;
   }
 
   sprintf(paragraph, formatter, block->content, content);
   free(block->content);
+  free(parsed_line);
   block->content = paragraph;
 }
 
@@ -1158,11 +1461,54 @@ void free_mdblocks(MDBlock *block) {
   if (block->tag) {
     free(block->tag);
   }
+  free_line_list(block->lines);
   free_mdblocks(block->child);
   free_mdblocks(block->next);
   free(block);
 }
 
+static bool str_equal(const char *a, const char *b) {
+  if (a == NULL || b == NULL) {
+    return a == b;
+  }
+  return strcmp(a, b) == 0;
+}
+
+static bool line_list_equal(const LineList *a, const LineList *b) {
+  if (a == NULL || b == NULL) {
+    return a == b;
+  }
+  if (a->count != b->count) {
+    return false;
+  }
+  for (int i = 0; i < a->count; i++) {
+    if (!str_equal(a->lines[i], b->lines[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// mdblock_equal compares two blocks and their children, but not the blocks
+// following them
+bool mdblock_equal(const MDBlock *a, const MDBlock *b) {
+  if (a->block != b->block || a->type != b->type ||
+      !str_equal(a->tag, b->tag) || !str_equal(a->content, b->content) ||
+      !line_list_equal(a->lines, b->lines)) {
+    return false;
+  }
+  return mdblocks_equal(a->child, b->child);
+}
+
+bool mdblocks_equal(const MDBlock *a, const MDBlock *b) {
+  for (; a != NULL && b != NULL; a = a->next, b = b->next) {
+    if (!mdblock_equal(a, b)) {
+      return false;
+    }
+  }
+  return a == NULL && b == NULL;
+}
+
 char *blocktag_to_string(BlockTag block) {
   switch (block) {
   case H1:
@@ -43,11 +43,25 @@ typedef enum {
   NONE,
 } TagType;
 
+// Line views of a block. Container blocks (blockquote, lists, list items)
+// parse them into child blocks, code and raw html blocks are written from
+// them verbatim. Entries point into the source lines, except list item
+// segments joined from lazy continuation lines which are allocated and marked
+// in owned. The list lives as long as the block since verbatim descendants
+// may still point into it.
+typedef struct {
+  char **lines;
+  bool *owned;
+  int count;
+  int capacity;
+} LineList;
+
 typedef struct MDBlock {
   char *content;
   char *tag;
   TagType type;
   BlockTag block;
+  LineList *lines;
   struct MDBlock *child;
   struct MDBlock *next;
 } MDBlock;
@@ -55,12 +69,19 @@ typedef struct MDBlock {
 typedef struct {
   MDBlock* (*parser)(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader);
   int multiline;
+  const char *name;
 } Parsers;
 
 
 MDBlock* new_mdblock(char *content, char *html_tag, BlockTag block_tag, 
                      TagType type, int content_newline);
 void free_mdblocks(MDBlock *block);
+bool mdblock_equal(const MDBlock *a, const MDBlock *b);
+bool mdblocks_equal(const MDBlock *a, const MDBlock *b);
+MDBlock *new_container_block(char *html_tag, BlockTag block_tag);
+MDBlock *new_verbatim_block(char *html_tag, BlockTag block_tag, TagType type);
+int line_list_push(LineList *cl, char *line, bool owned);
+void free_line_list(LineList *cl);
 
 MDBlock *block_parsing(MDBlock *prnt_block, MDBlock *block, PeekReader *reader, MDLinkReference *link_ref_head);
 MDBlock *heading_parser(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader);
@@ -75,15 +96,18 @@ MDBlock *paragraph_parser(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *
 MDBlock *section_break_parser(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader);
 MDBlock *link_reference_parser(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader);
 MDBlock *html_tag_parser(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader);
+MDBlock *document_block_parsing(MDLinkReference *link_ref_head, PeekReader *reader);
 MDBlock *child_block_parsing(MDLinkReference *link_ref_head, MDBlock *block);
-MDBlock *content_block_parsing(MDBlock *prnt_block, MDBlock *curr_block, PeekReader *reader, MDLinkReference *link_ref_head);
 
+// Set before block parsing to leave inline parsing to inline_parsing_tree
+extern bool defer_inline_parsing;
 void inline_parsing(MDLinkReference *list, MDBlock *block);
-void escape_char_parsing(char *str);
+void inline_parsing_tree(MDLinkReference *list, MDBlock *block);
 char *line_break_parser(const char *line);
 char *emphasis_parser(char *str);
-char *link_parser(MDLinkReference *list, char *str);
-char *image_parser(char *str); 
+char *link_parser(MDLinkReference *list, char *str,
+                  const MDSpanList *code_spans);
+char *image_parser(char *str, MDSpanList *code_spans);
 
 int is_header_block(MDBlock block);
 int is_heading_syntax(char **str);
@@ -4,6 +4,7 @@
 
 #include <ctype.h>
 #include <pcre2.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,17 +15,19 @@
 static int cmp_md_link_start(const void *a, const void *b);
 
 MDLinkRegex *parse_markdown_links(MDLinkReference *head, const char *str,
+                                  const MDSpanList *code_spans,
                                   size_t *result_count) {
   size_t general_link_count = 0;
   MDLinkRegex *general_links =
-      parse_markdown_general_links(str, &general_link_count);
+      parse_markdown_general_links(str, code_spans, &general_link_count);
 
   size_t simple_address_count = 0;
   MDLinkRegex *simple_addresses =
-      parse_simple_addresses(str, &simple_address_count);
+      parse_simple_addresses(str, code_spans, &simple_address_count);
 
   size_t tag_link_count = 0;
-  MDLinkRegex *tag_links = parse_markdown_links_tag(head, str, &tag_link_count);
+  MDLinkRegex *tag_links =
+      parse_markdown_links_tag(head, str, code_spans, &tag_link_count);
 
   // Combine both arrays
   size_t total_count =
@@ -58,6 +61,7 @@ MDLinkRegex *parse_markdown_links(MDLinkReference *head, const char *str,
 }
 
 MDLinkRegex *parse_markdown_general_links(const char *str,
+                                          const MDSpanList *code_spans,
                                           size_t *result_count) {
   if (str == NULL) {
     return NULL;
@@ -65,8 +69,7 @@ MDLinkRegex *parse_markdown_general_links(const char *str,
 
   PCRE2_SPTR8 subject = (PCRE2_SPTR8)str;
   PCRE2_SPTR8 pattern =
-      (PCRE2_SPTR8) "(?s)<code>.*?</code>(*SKIP)(*FAIL)|"
-                    "\\[([^\\]]+)\\]\\(([^)\\s]+)(?:\\s+\"([^\"]+)\")?\\)";
+      (PCRE2_SPTR8) "\\[([^\\]]+)\\]\\(([^)\\s]+)(?:\\s+\"([^\"]+)\")?\\)";
 
   int errorcode;
   PCRE2_SIZE erroroffset;
@@ -106,6 +109,13 @@ MDLinkRegex *parse_markdown_general_links(const char *str,
     // [6]..[7]=group3
     PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
 
+    // Matches starting inside a code span are ignored, resume after it
+    PCRE2_SIZE span_end = code_span_end_at(code_spans, ov[0]);
+    if (span_end) {
+      offset = span_end;
+      continue;
+    }
+
     // Checking escape syntax
     // label part
     if (ov[2] >= 1 && subject[ov[2] - 1] == '[') {
@@ -199,14 +209,15 @@ MDLinkRegex *parse_markdown_general_links(const char *str,
 }
 
 MDLinkRegex *parse_markdown_links_tag(MDLinkReference *head, const char *str,
+                                      const MDSpanList *code_spans,
                                       size_t *result_count) {
   if (str == NULL) {
     return NULL;
   }
 
   PCRE2_SPTR8 subject = (PCRE2_SPTR8)str;
-  PCRE2_SPTR8 pattern = (PCRE2_SPTR8) "(?s)<code>.*?</code>(*SKIP)(*FAIL)|"
-                                      "\\[([^\\]]+)\\]\\ ?\\[([^\\]]+)\\]";
+  PCRE2_SPTR8 pattern =
+      (PCRE2_SPTR8) "\\[([^\\]]+)\\]\\ ?\\[([^\\]]+)\\]";
 
   int errorcode;
   PCRE2_SIZE erroroffset;
@@ -243,6 +254,13 @@ MDLinkRegex *parse_markdown_links_tag(MDLinkReference *head, const char *str,
     // [0]..[1] = full-match start/end, [2]..[3]=group1, [4]..[5]=group2
     PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
 
+    // Matches starting inside a code span are ignored, resume after it
+    PCRE2_SIZE span_end = code_span_end_at(code_spans, ov[0]);
+    if (span_end) {
+      offset = span_end;
+      continue;
+    }
+
     // Checking escape syntax
     // label part
     if (ov[2] >= 1 && subject[ov[2] - 1] == '[') {
@@ -313,14 +331,14 @@ MDLinkRegex *parse_markdown_links_tag(MDLinkReference *head, const char *str,
   return arr;
 }
 
-MDLinkReference *parse_markdown_links_reference(char *str) {
-  if (str == NULL) {
-    return NULL;
-  }
+// Compiled once by the first caller, matching only reads it so every thread
+// shares it
+static pcre2_code_8 *link_reference_re = NULL;
+static pthread_once_t link_reference_re_once = PTHREAD_ONCE_INIT;
 
+static void compile_link_reference_re(void) {
   PCRE2_SPTR8 pattern =
-      (PCRE2_SPTR8) "(?s)<code>.*?</code>(*SKIP)(*FAIL)|"
-                    "^[ \\t]*" // optional leading space/tabs
+      (PCRE2_SPTR8) "^[ \\t]*" // optional leading space/tabs
                     "\\[([A-Za-z0-9 "
                     "!\"#$%&'()*+,\\-./:;<=>?@[\\\\\\]^_`{|}~]+)\\]" // 1:
                                                                      // reference
@@ -340,70 +358,88 @@ MDLinkReference *parse_markdown_links_reference(char *str) {
   PCRE2_SIZE erroroffset;
 
   // Compile with UTF and Unicode-property support
-  pcre2_code_8 *re =
+  link_reference_re =
       pcre2_compile_8(pattern, PCRE2_ZERO_TERMINATED, PCRE2_UTF | PCRE2_UCP,
                       &errorcode, &erroroffset, NULL);
-  if (!re) {
+  if (!link_reference_re) {
     PCRE2_UCHAR8 buffer[256];
     pcre2_get_error_message_8(errorcode, buffer, sizeof(buffer));
     LOGF("PCRE2 compilation failed at offset %zu: %s\n", erroroffset, buffer);
-    return NULL;
   }
+}
 
-  pcre2_match_data_8 *md = pcre2_match_data_create_from_pattern_8(re, NULL);
-  PCRE2_SIZE str_len = strlen(str);
-  PCRE2_SIZE offset = 0;
-  int rc;
-
-  if ((rc = pcre2_match_8(re, (PCRE2_SPTR8)str, str_len, offset, 0, md, NULL)) <
-      0) {
-    pcre2_match_data_free_8(md);
-    pcre2_code_free_8(re);
-    return NULL; // No match found
+// may_be_link_reference checks the bytes every reference definition starts
+// with: optional indent, '[' and a later "]:". Lines failing it never match
+// the full pattern.
+bool may_be_link_reference(const char *line) {
+  while (*line == ' ' || *line == '\t') {
+    line++;
   }
+  return *line == '[' && strstr(line + 1, "]:") != NULL;
+}
 
-  PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
-
-  // Checking escape syntax
+// A delimiter of the label, url or title preceded by a backslash is literal
+static bool link_reference_escaped(const char *subject, const PCRE2_SIZE *ov) {
   // label part
-  PCRE2_SPTR8 subject = (PCRE2_SPTR8)str;
-  if (ov[2] >= 1 && subject[ov[2] - 1] == '[') {
-    if (is_escaped_at((char *)subject, ov[2] - 1)) {
-      return NULL;
-    }
+  if (ov[2] >= 1 && subject[ov[2] - 1] == '[' &&
+      is_escaped_at(subject, ov[2] - 1)) {
+    return true;
   }
-  if (subject[ov[3]] == ']') {
-    if (is_escaped_at((char *)subject, ov[3])) {
-      return NULL;
-    }
+  if (subject[ov[3]] == ']' && is_escaped_at(subject, ov[3])) {
+    return true;
   }
   // url part
-  if (ov[4] >= 1 && subject[ov[4] - 1] == '<') {
-    if (is_escaped_at((char *)subject, ov[4] - 1)) {
-      return NULL;
-    }
+  if (ov[4] >= 1 && subject[ov[4] - 1] == '<' &&
+      is_escaped_at(subject, ov[4] - 1)) {
+    return true;
   }
-  if (subject[ov[5]] == '>') {
-    if (is_escaped_at((char *)subject, ov[5])) {
-      return NULL;
-    }
+  if (subject[ov[5]] == '>' && is_escaped_at(subject, ov[5])) {
+    return true;
   }
   // title part
   if (ov[6] != PCRE2_UNSET && ov[7] != PCRE2_UNSET) {
     if (ov[6] >= 1 &&
         (subject[ov[6] - 1] == '"' || subject[ov[6] - 1] == '\'' ||
-         subject[ov[6] - 1] == '(')) {
-      if (is_escaped_at((char *)subject, ov[6] - 1)) {
-        return NULL;
-      }
+         subject[ov[6] - 1] == '(') &&
+        is_escaped_at(subject, ov[6] - 1)) {
+      return true;
     }
-    if (subject[ov[7]] == '"' || subject[ov[7]] == '\'' ||
-        subject[ov[7]] == ')') {
-      if (is_escaped_at((char *)subject, ov[7])) {
-        return NULL;
-      }
+    if ((subject[ov[7]] == '"' || subject[ov[7]] == '\'' ||
+         subject[ov[7]] == ')') &&
+        is_escaped_at(subject, ov[7])) {
+      return true;
     }
   }
+  return false;
+}
+
+MDLinkReference *parse_markdown_links_reference(char *str) {
+  if (str == NULL || !may_be_link_reference(str)) {
+    return NULL;
+  }
+
+  pthread_once(&link_reference_re_once, compile_link_reference_re);
+  pcre2_code_8 *re = link_reference_re;
+  if (!re) {
+    return NULL;
+  }
+
+  pcre2_match_data_8 *md = pcre2_match_data_create_from_pattern_8(re, NULL);
+  PCRE2_SIZE str_len = strlen(str);
+  PCRE2_SIZE offset = 0;
+  int rc;
+
+  if ((rc = pcre2_match_8(re, (PCRE2_SPTR8)str, str_len, offset, 0, md, NULL)) <
+      0) {
+    pcre2_match_data_free_8(md);
+    return NULL; // No match found
+  }
+
+  PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
+  if (link_reference_escaped(str, ov)) {
+    pcre2_match_data_free_8(md);
+    return NULL;
+  }
 
   char *label = malloc(ov[3] - ov[2] + 1);
   char *url = malloc(ov[5] - ov[4] + 1);
@@ -423,7 +459,6 @@ MDLinkReference *parse_markdown_links_reference(char *str) {
   MDLinkReference *ref = new_md_link_reference(label, url, title);
 
   pcre2_match_data_free_8(md);
-  pcre2_code_free_8(re);
 
   free(label);
   free(url);
@@ -436,15 +471,16 @@ MDLinkReference *parse_markdown_links_reference(char *str) {
 
 // parsing url and email addresses that is enclose in angle brackets.
 // For example: <https://www.markdownguide.org> or <fake@example.com>
-MDLinkRegex *parse_simple_addresses(const char *str, size_t *result_count) {
+MDLinkRegex *parse_simple_addresses(const char *str,
+                                    const MDSpanList *code_spans,
+                                    size_t *result_count) {
   if (str == NULL) {
     return NULL;
   }
 
   PCRE2_SPTR8 subject = (PCRE2_SPTR8)str;
   PCRE2_SPTR8 pattern =
-      (PCRE2_SPTR8) "(?s)<code>.*?</code>(*SKIP)(*FAIL)|"
-                    "<((https?://"
+      (PCRE2_SPTR8) "<((https?://"
                     "[^\\s<>]+)|([a-zA-Z0-9._%+-]+@[a-zA-Z0-9."
                     "-]+\\.[a-zA-Z]{2,}))>";
 
@@ -486,6 +522,13 @@ MDLinkRegex *parse_simple_addresses(const char *str, size_t *result_count) {
     // [6]..[7]=group3
     PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
 
+    // Matches starting inside a code span are ignored, resume after it
+    PCRE2_SIZE span_end = code_span_end_at(code_spans, ov[0]);
+    if (span_end) {
+      offset = span_end;
+      continue;
+    }
+
     // Checking escape syntax
     if (ov[2] >= 1 && subject[ov[2] - 1] == '<') {
       if (is_escaped_at((char *)subject, ov[2] - 1)) {
@@ -551,7 +594,9 @@ MDLinkRegex *parse_simple_addresses(const char *str, size_t *result_count) {
   return arr;
 }
 
-MDLinkRegex *parse_markdown_images(const char *str, size_t *result_count) {
+MDLinkRegex *parse_markdown_images(const char *str,
+                                   const MDSpanList *code_spans,
+                                   size_t *result_count) {
   if (str == NULL) {
     return NULL;
   }
@@ -598,6 +643,13 @@ MDLinkRegex *parse_markdown_images(const char *str, size_t *result_count) {
     // [6]..[7]=group3
     PCRE2_SIZE *ov = pcre2_get_ovector_pointer_8(md);
 
+    // Matches starting inside a code span are ignored, resume after it
+    PCRE2_SIZE span_end = code_span_end_at(code_spans, ov[0]);
+    if (span_end) {
+      offset = span_end;
+      continue;
+    }
+
     // Checking escape syntax
     // Checking starting `!`
     if (ov[0] >= 1) {
@@ -725,6 +777,25 @@ MDLinkReference *gen_markdown_link_reference_list(PeekReader *reader) {
   return head;
 }
 
+// scan_link_references parses the definitions among count lines into a
+// list, the last definition first like gen_markdown_link_reference_list.
+// reference_lines, when given, gets whether each line is a definition.
+MDLinkReference *scan_link_references(char **lines, int count,
+                                      bool *reference_lines) {
+  MDLinkReference *head = NULL;
+  for (int i = 0; i < count; i++) {
+    MDLinkReference *ref = parse_markdown_links_reference(lines[i]);
+    if (reference_lines != NULL) {
+      reference_lines[i] = ref != NULL;
+    }
+    if (ref != NULL) {
+      ref->next = head;
+      head = ref;
+    }
+  }
+  return head;
+}
+
 MDLinkReference *find_link_reference(MDLinkReference *head, char *label) {
   if (head == NULL || label == NULL) {
     return NULL;
@@ -816,6 +887,25 @@ void print_md_links_reference(MDLinkReference *head) {
   }
 }
 
+static bool optional_str_equal(const char *a, const char *b) {
+  if (a == NULL || b == NULL) {
+    return a == b;
+  }
+  return strcmp(a, b) == 0;
+}
+
+// md_link_references_equal compares two lists entry by entry, in order
+bool md_link_references_equal(const MDLinkReference *a,
+                              const MDLinkReference *b) {
+  for (; a != NULL && b != NULL; a = a->next, b = b->next) {
+    if (strcmp(a->label, b->label) != 0 || strcmp(a->url, b->url) != 0 ||
+        !optional_str_equal(a->title, b->title)) {
+      return false;
+    }
+  }
+  return a == NULL && b == NULL;
+}
+
 void free_md_link_reference(MDLinkReference *head) {
   MDLinkReference *current = head;
   while (current) {
@@ -871,6 +961,104 @@ bool is_escaped(const char *str, char start_target, char end_target,
   return false;
 }
 
+// find_code_spans records every <code>...</code> span of str, pairing each
+// opening tag with the first closing tag after it.
+MDSpanList *find_code_spans(const char *str) {
+  MDSpanList *list = malloc(sizeof(MDSpanList));
+  if (!list) {
+    perror("malloc failed");
+    return NULL;
+  }
+  list->spans = NULL;
+  list->count = 0;
+  if (str == NULL) {
+    return list;
+  }
+
+  size_t capacity = 0;
+  const char *p = str;
+  while ((p = strstr(p, "<code>")) != NULL) {
+    const char *close = strstr(p + 6, "</code>");
+    if (close == NULL) {
+      break;
+    }
+
+    if (list->count == capacity) {
+      capacity = capacity ? capacity * 2 : 4;
+      MDSpan *spans = realloc(list->spans, capacity * sizeof(MDSpan));
+      if (!spans) {
+        perror("Unable to reallocate code spans");
+        break;
+      }
+      list->spans = spans;
+    }
+    list->spans[list->count].start = p - str;
+    list->spans[list->count].end = close + 7 - str;
+    list->count++;
+
+    p = close + 7;
+  }
+
+  return list;
+}
+
+// code_span_end_at returns the end of the code span containing pos, or 0 if
+// pos is outside every span.
+size_t code_span_end_at(const MDSpanList *code_spans, size_t pos) {
+  if (code_spans == NULL || code_spans->count == 0) {
+    return 0;
+  }
+
+  // Last span starting at or before pos
+  size_t lo = 0;
+  size_t hi = code_spans->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (code_spans->spans[mid].start <= pos) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == 0) {
+    return 0;
+  }
+
+  const MDSpan *span = &code_spans->spans[lo - 1];
+  return pos < span->end ? span->end : 0;
+}
+
+// shift_code_spans updates the spans after [start, end) of the content was
+// replaced by new_len bytes. Spans inside the replaced range are dropped.
+void shift_code_spans(MDSpanList *code_spans, size_t start, size_t end,
+                      size_t new_len) {
+  if (code_spans == NULL) {
+    return;
+  }
+
+  size_t kept = 0;
+  for (size_t i = 0; i < code_spans->count; i++) {
+    MDSpan span = code_spans->spans[i];
+    if (span.start >= end) {
+      span.start = span.start - end + start + new_len;
+      span.end = span.end - end + start + new_len;
+    } else if (span.end > start) {
+      continue;
+    }
+    code_spans->spans[kept++] = span;
+  }
+  code_spans->count = kept;
+}
+
+void free_code_spans(MDSpanList *code_spans) {
+  if (code_spans == NULL) {
+    return;
+  }
+
+  free(code_spans->spans);
+  free(code_spans);
+}
+
 static int cmp_md_link_start(const void *a, const void *b) {
   MDLinkRegex *linkA = (MDLinkRegex *)a;
   MDLinkRegex *linkB = (MDLinkRegex *)b;
@@ -919,8 +1107,10 @@ int main(void) {
                     "search engine for privacy\")</code> haha\n";
 
   size_t link_count = 0;
-  MDLinkRegex *links =
-      parse_markdown_links(ref_head, (const char *)subject, &link_count);
+  MDSpanList *code_spans = find_code_spans((const char *)subject);
+  MDLinkRegex *links = parse_markdown_links(ref_head, (const char *)subject,
+                                            code_spans, &link_count);
+  free_code_spans(code_spans);
 
   for (size_t i = 0; i < link_count; i++) {
     printf("Link %zu:\n", i + 1);
@@ -947,7 +1137,7 @@ int main(void) {
                             "[Error link with no reference][error]\n";
 
   link_count = 0;
-  links = parse_markdown_links(ref_head, tag_subject, &link_count);
+  links = parse_markdown_links(ref_head, tag_subject, NULL, &link_count);
 
   for (size_t i = 0; i < link_count; i++) {
     printf("Link %zu:\n", i + 1);
@@ -973,7 +1163,7 @@ int main(void) {
                                "<www.invalid.com>, <fake#invalid.com>";
 
   link_count = 0;
-  links = parse_markdown_links(ref_head, simple_subject, &link_count);
+  links = parse_markdown_links(ref_head, simple_subject, NULL, &link_count);
   for (size_t i = 0; i < link_count; i++) {
     printf("Link %zu:\n", i + 1);
     printf("  Label : \"%s\"\n", links[i].label);
@@ -1006,7 +1196,7 @@ int main(void) {
       "Title\")\n";
 
   link_count = 0;
-  links = parse_markdown_images(image_subject, &link_count);
+  links = parse_markdown_images(image_subject, NULL, &link_count);
   for (size_t i = 0; i < link_count; i++) {
     printf("Link %zu:\n", i + 1);
     printf("  Label : \"%s\"\n", links[i].label);
@@ -19,6 +19,20 @@ typedef struct {
   int end;
 } MDLinkRegex;
 
+// Byte range [start, end) of a <code>...</code> span in inline content
+typedef struct {
+  size_t start;
+  size_t end;
+} MDSpan;
+
+// Code spans of one block's content sorted by start. Computed once after the
+// emphasis stage and shared by every link and image scan of the block, which
+// ignore matches starting inside a span.
+typedef struct {
+  MDSpan *spans;
+  size_t count;
+} MDSpanList;
+
 typedef struct MDLinkReference {
   char *label;
   char *url;
@@ -27,18 +41,28 @@ typedef struct MDLinkReference {
 } MDLinkReference;
 
 MDLinkRegex *new_md_link(const char *label, const char *url, const char *title, const char *src, int start, int end);
-MDLinkRegex *parse_markdown_links(MDLinkReference *head, const char *str, size_t *result_count);
-MDLinkRegex *parse_markdown_general_links(const char *str, size_t *result_count);
-MDLinkRegex *parse_markdown_links_tag(MDLinkReference *head, const char *str, size_t *result_count);
-MDLinkRegex *parse_simple_addresses(const char *str, size_t *result_count);
-MDLinkRegex *parse_markdown_images(const char *str, size_t *result_count);
+MDLinkRegex *parse_markdown_links(MDLinkReference *head, const char *str, const MDSpanList *code_spans, size_t *result_count);
+MDLinkRegex *parse_markdown_general_links(const char *str, const MDSpanList *code_spans, size_t *result_count);
+MDLinkRegex *parse_markdown_links_tag(MDLinkReference *head, const char *str, const MDSpanList *code_spans, size_t *result_count);
+MDLinkRegex *parse_simple_addresses(const char *str, const MDSpanList *code_spans, size_t *result_count);
+MDLinkRegex *parse_markdown_images(const char *str, const MDSpanList *code_spans, size_t *result_count);
 void free_md_links(MDLinkRegex *links, size_t count);
 
+MDSpanList *find_code_spans(const char *str);
+size_t code_span_end_at(const MDSpanList *code_spans, size_t pos);
+void shift_code_spans(MDSpanList *code_spans, size_t start, size_t end, size_t new_len);
+void free_code_spans(MDSpanList *code_spans);
+
 MDLinkReference *parse_markdown_links_reference(char *str);
 MDLinkReference *new_md_link_reference(const char *label, const char *url, const char *title);
 MDLinkReference *find_link_reference(MDLinkReference *head, char *label);
 MDLinkReference *gen_markdown_link_reference_list(PeekReader *reader);
+MDLinkReference *scan_link_references(char **lines, int count,
+                                      bool *reference_lines);
+bool may_be_link_reference(const char *line);
 void print_md_links_reference(MDLinkReference *head);
+bool md_link_references_equal(const MDLinkReference *a,
+                              const MDLinkReference *b);
 void free_md_link_reference(MDLinkReference *head);
 
 void str_to_lower(char *str);
@@ -0,0 +1,143 @@
+#include <malloc.h>
+#include <sys/resource.h>
+
+#include "alloc_stats.h"
+#include "mem_profile.h"
+
+#define BLOCK_TAG_COUNT (PLAIN + 1)
+
+bool mem_profile_enabled = false;
+
+typedef enum {
+  MEM_BLOCK_NODES,      // MDBlock structs
+  MEM_BLOCK_CONTENT,    // converted content and html tags
+  MEM_CONTAINER_LINES,  // line lists kept by container and verbatim blocks
+  MEM_LINK_REFERENCES,  // MDLinkReference entries and their strings
+  MEM_SOURCE,           // input buffer and line table the readers view
+  MEM_INLINE_TEMPS,     // largest growth during one inline_parsing call
+  MEM_CATEGORY_COUNT,
+} MemCategory;
+
+static const char *category_names[MEM_CATEGORY_COUNT] = {
+    "block nodes",     "block content", "container lines",
+    "link references", "source",        "inline temporaries",
+};
+
+static size_t category_bytes[MEM_CATEGORY_COUNT];
+static size_t tag_blocks[BLOCK_TAG_COUNT];
+static size_t tag_bytes[BLOCK_TAG_COUNT];
+static size_t input_bytes = 0;
+static long live_bytes = 0;
+
+void mem_profile_enable(void) {
+  mem_profile_enabled = true;
+  alloc_stats_enable();
+}
+
+void mem_profile_inline_begin(void) { alloc_stats_window_begin(); }
+
+void mem_profile_inline_end(void) {
+  size_t temps = alloc_stats_window_end();
+  size_t *largest = &category_bytes[MEM_INLINE_TEMPS];
+  size_t seen = __atomic_load_n(largest, __ATOMIC_RELAXED);
+  while (temps > seen &&
+         !__atomic_compare_exchange_n(largest, &seen, temps, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+}
+
+static size_t line_list_bytes(const LineList *cl) {
+  if (cl == NULL) {
+    return 0;
+  }
+
+  size_t bytes = malloc_usable_size((void *)cl) +
+                 malloc_usable_size(cl->lines) + malloc_usable_size(cl->owned);
+  for (int i = 0; i < cl->count; i++) {
+    if (cl->owned[i]) {
+      bytes += malloc_usable_size(cl->lines[i]);
+    }
+  }
+  return bytes;
+}
+
+static void count_blocks(const MDBlock *block) {
+  for (; block != NULL; block = block->next) {
+    size_t node = malloc_usable_size((void *)block);
+    size_t content =
+        malloc_usable_size(block->content) + malloc_usable_size(block->tag);
+    size_t lines = line_list_bytes(block->lines);
+    category_bytes[MEM_BLOCK_NODES] += node;
+    category_bytes[MEM_BLOCK_CONTENT] += content;
+    category_bytes[MEM_CONTAINER_LINES] += lines;
+    if (block->block < BLOCK_TAG_COUNT) {
+      tag_blocks[block->block]++;
+      tag_bytes[block->block] += node + content + lines;
+    }
+    count_blocks(block->child);
+  }
+}
+
+// mem_profile_snapshot sizes the parsed document while it is fully built,
+// which is when the retained heap is largest.
+void mem_profile_snapshot(const MDBlock *head, const MDLinkReference *refs,
+                          const MDSource *source) {
+  live_bytes = alloc_stats_current();
+  count_blocks(head);
+
+  for (; refs != NULL; refs = refs->next) {
+    category_bytes[MEM_LINK_REFERENCES] +=
+        malloc_usable_size((void *)refs) + malloc_usable_size(refs->label) +
+        malloc_usable_size(refs->url) + malloc_usable_size(refs->title);
+  }
+
+  if (source != NULL) {
+    mem_profile_source(source->size, malloc_usable_size((void *)source) +
+                                         malloc_usable_size(source->buffer) +
+                                         malloc_usable_size(source->lines));
+  }
+}
+
+// mem_profile_source sets the input size and the bytes retained for it, for
+// inputs not held in an MDSource
+void mem_profile_source(size_t size, size_t retained_bytes) {
+  input_bytes = size;
+  category_bytes[MEM_SOURCE] = retained_bytes;
+}
+
+static double per_input_byte(double bytes) {
+  return input_bytes > 0 ? bytes / input_bytes : 0;
+}
+
+void mem_profile_report(FILE *fp) {
+  AllocStats alloc = alloc_stats_get();
+  struct rusage usage;
+  long peak_rss_kb = getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+
+  fprintf(fp, "mthc memory profile\n");
+  fprintf(fp, "  %-20s %12s %10s\n", "category", "bytes", "per input");
+  long accounted = 0;
+  for (int i = 0; i < MEM_CATEGORY_COUNT; i++) {
+    fprintf(fp, "  %-20s %12zu %10.2f\n", category_names[i],
+            category_bytes[i], per_input_byte(category_bytes[i]));
+    if (i != MEM_INLINE_TEMPS) {
+      accounted += category_bytes[i];
+    }
+  }
+  long other = live_bytes > accounted ? live_bytes - accounted : 0;
+  fprintf(fp, "  %-20s %12ld %10.2f\n", "other", other, per_input_byte(other));
+  fprintf(fp, "  %-20s %12ld %10.2f\n", "live after parsing", live_bytes,
+          per_input_byte(live_bytes));
+  fprintf(fp, "  %-20s %12zu %10.2f\n", "peak heap", alloc.peak_bytes,
+          per_input_byte(alloc.peak_bytes));
+  fprintf(fp, "  input bytes: %zu, peak rss: %ld KB\n", input_bytes,
+          peak_rss_kb);
+
+  fprintf(fp, "  %-20s %12s %12s\n", "block type", "blocks", "bytes");
+  for (int i = 0; i < BLOCK_TAG_COUNT; i++) {
+    if (tag_blocks[i] > 0) {
+      fprintf(fp, "  %-20s %12zu %12zu\n", blocktag_to_string(i),
+              tag_blocks[i], tag_bytes[i]);
+    }
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef MEM_PROFILE_H
+#define MEM_PROFILE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "file_reader.h"
+#include "md_parser.h"
+#include "md_regex.h"
+
+extern bool mem_profile_enabled;
+
+void mem_profile_enable(void);
+
+// Brackets one inline_parsing call, the largest heap growth seen inside any
+// call is reported as inline temporaries
+void mem_profile_inline_begin(void);
+void mem_profile_inline_end(void);
+
+void mem_profile_snapshot(const MDBlock *head, const MDLinkReference *refs,
+                          const MDSource *source);
+void mem_profile_source(size_t size, size_t retained_bytes);
+void mem_profile_report(FILE *fp);
+
+#endif
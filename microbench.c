@@ -0,0 +1,358 @@
+// microbench: time the hot parsing functions in isolation over fixed inputs.
+// Reports ns/op, bytes/op and allocs/op, and writes the results as JSON so
+// later runs can be compared against a saved baseline.
+// Usage: microbench [--output=FILE] [--baseline=FILE] [--filter=NAME]
+//                   [--min-time=MS]
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "alloc_stats.h"
+#include "file_reader.h"
+#include "logger.h"
+#include "md_parser.h"
+#include "md_regex.h"
+#include "str_utils.h"
+
+#define DEFAULT_MIN_TIME_MS 200
+#define MAX_NAME_LEN 64
+
+typedef struct {
+  const char *name;
+  void (*op)(void);
+  size_t input_bytes;
+} Bench;
+
+typedef struct {
+  char name[MAX_NAME_LEN];
+  double ns_per_op;
+} BaselineEntry;
+
+// Fixed inputs, built once by build_inputs
+static char *prose_input;
+static char *emphasis_input;
+static char *inline_input;
+static char *links_input;
+static char *images_input;
+static char *lines_input;
+static MDSpanList *links_code_spans;
+static MDLinkReference *link_refs;
+
+static const char *heading_input =
+    "Heading With `Code`, Punctuation & Unicode 標題 (Test)";
+static char reference_input[] =
+    "[Reference Label]: <https://example.com/some/path> \"Reference Title\"";
+static char html_tag_input[] =
+    "<div class=\"container\" id='main' data-value=plain hidden>";
+
+// Sink for results so the compiler keeps every call
+static volatile size_t sink;
+
+static char *repeat_str(const char *unit, size_t times, const char *tail) {
+  size_t unit_len = strlen(unit);
+  size_t tail_len = tail ? strlen(tail) : 0;
+  char *str = malloc(unit_len * times + tail_len + 1);
+  if (!str) {
+    perror("malloc failed");
+    exit(1);
+  }
+
+  char *p = str;
+  for (size_t i = 0; i < times; i++) {
+    memcpy(p, unit, unit_len);
+    p += unit_len;
+  }
+  if (tail) {
+    memcpy(p, tail, tail_len);
+    p += tail_len;
+  }
+  *p = '\0';
+  return str;
+}
+
+static void build_inputs(void) {
+  // Pairs sit at the end so the finders scan the whole input
+  prose_input = repeat_str("lorem ipsum dolor sit amet, consectetur ", 64,
+                           "*emphasis* and `code` end");
+  emphasis_input = repeat_str("plain *em* text **strong** and _under_ ", 64,
+                              NULL);
+  inline_input = repeat_str("text *em* **strong** `code *not em*` word ", 48,
+                            NULL);
+  links_input = repeat_str(
+      "see [label](https://example.com/path \"title\") and [ref][r1] then "
+      "<https://example.org> with <code>[x](y)</code> ",
+      24, NULL);
+  images_input = repeat_str(
+      "an ![alt text](https://example.com/image.png \"Image\") inline ", 32,
+      NULL);
+  lines_input = repeat_str("a line of markdown content for splitting\n", 100,
+                           NULL);
+
+  links_code_spans = find_code_spans(links_input);
+  link_refs = new_md_link_reference("r1", "https://example.net", NULL);
+}
+
+static void free_inputs(void) {
+  free(prose_input);
+  free(emphasis_input);
+  free(inline_input);
+  free(links_input);
+  free(images_input);
+  free(lines_input);
+  free_code_spans(links_code_spans);
+  free_md_link_reference(link_refs);
+}
+
+static void op_find_emphasis_pair(void) {
+  TagPair *pair = find_emphasis_pair(prose_input, (uint8_t *)prose_input);
+  sink += pair != NULL;
+  free_tag_pair(pair);
+}
+
+static void op_find_code_tag_pair(void) {
+  TagPair *pair = find_code_tag_pair(prose_input, (uint8_t *)prose_input);
+  sink += pair != NULL;
+  free_tag_pair(pair);
+}
+
+static void op_fullstr_sub_tagpair(void) {
+  bool sub = false;
+  char *result = fullstr_sub_tagpair(inline_input, PT_NONE, &sub);
+  sink += result != NULL;
+  free(result);
+}
+
+static void op_fullstr_sub_tagpair_emphasis(void) {
+  bool sub = false;
+  char *result = fullstr_sub_tagpair(emphasis_input, PT_NONE, &sub);
+  sink += result != NULL;
+  free(result);
+}
+
+static void op_convert_id_tag(void) {
+  char *id = convert_id_tag(heading_input);
+  sink += id != NULL;
+  free(id);
+}
+
+static void op_parse_markdown_links(void) {
+  size_t count = 0;
+  MDLinkRegex *links =
+      parse_markdown_links(link_refs, links_input, links_code_spans, &count);
+  sink += count;
+  free_md_links(links, count);
+}
+
+static void op_parse_markdown_images(void) {
+  size_t count = 0;
+  MDLinkRegex *images = parse_markdown_images(images_input, NULL, &count);
+  sink += count;
+  free_md_links(images, count);
+}
+
+static void op_parse_markdown_links_reference(void) {
+  MDLinkReference *ref = parse_markdown_links_reference(reference_input);
+  sink += ref != NULL;
+  free_md_link_reference(ref);
+}
+
+static void op_is_html_start_tag(void) {
+  sink += is_html_start_tag(html_tag_input, strlen(html_tag_input));
+}
+
+static void op_content_splitter(void) {
+  int count = 0;
+  char **lines = content_splitter(lines_input, '\n', &count);
+  sink += count;
+  for (int i = 0; i < count; i++) {
+    free(lines[i]);
+  }
+  free(lines);
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double run_batch(const Bench *bench, size_t iterations) {
+  double start = now_ns();
+  for (size_t i = 0; i < iterations; i++) {
+    bench->op();
+  }
+  return now_ns() - start;
+}
+
+static size_t load_baseline(const char *path, BaselineEntry **entries) {
+  FILE *fp = fopen(path, "r");
+  if (!fp) {
+    perror("Failed to open baseline");
+    return 0;
+  }
+
+  size_t count = 0;
+  size_t capacity = 16;
+  *entries = malloc(capacity * sizeof(BaselineEntry));
+  if (!*entries) {
+    perror("malloc failed");
+    fclose(fp);
+    return 0;
+  }
+
+  // One benchmark object per line, as written by main below
+  char line[512];
+  while (fgets(line, sizeof(line), fp)) {
+    char *name = strstr(line, "\"name\": \"");
+    char *ns = strstr(line, "\"ns_per_op\": ");
+    if (!name || !ns) {
+      continue;
+    }
+    if (count == capacity) {
+      capacity *= 2;
+      BaselineEntry *tmp = realloc(*entries, capacity * sizeof(BaselineEntry));
+      if (!tmp) {
+        perror("Unable to reallocate baseline");
+        break;
+      }
+      *entries = tmp;
+    }
+    BaselineEntry *entry = &(*entries)[count];
+    if (sscanf(name, "\"name\": \"%63[^\"]\"", entry->name) == 1 &&
+        sscanf(ns, "\"ns_per_op\": %lf", &entry->ns_per_op) == 1) {
+      count++;
+    }
+  }
+
+  fclose(fp);
+  return count;
+}
+
+static const BaselineEntry *find_baseline(const BaselineEntry *entries,
+                                          size_t count, const char *name) {
+  for (size_t i = 0; i < count; i++) {
+    if (strcmp(entries[i].name, name) == 0) {
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  const char *output = "microbench.json";
+  const char *baseline = NULL;
+  const char *filter = NULL;
+  double min_time_ns = DEFAULT_MIN_TIME_MS * 1e6;
+
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--output=", 9) == 0) {
+      output = argv[i] + 9;
+    } else if (strncmp(argv[i], "--baseline=", 11) == 0) {
+      baseline = argv[i] + 11;
+    } else if (strncmp(argv[i], "--filter=", 9) == 0) {
+      filter = argv[i] + 9;
+    } else if (strncmp(argv[i], "--min-time=", 11) == 0) {
+      min_time_ns = atof(argv[i] + 11) * 1e6;
+    } else {
+      fprintf(stderr,
+              "Usage: %s [--output=FILE] [--baseline=FILE] [--filter=NAME] "
+              "[--min-time=MS]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+
+  log_init(false);
+  alloc_stats_enable();
+  build_inputs();
+
+  Bench benches[] = {
+      {"find_emphasis_pair", op_find_emphasis_pair, strlen(prose_input)},
+      {"find_code_tag_pair", op_find_code_tag_pair, strlen(prose_input)},
+      {"fullstr_sub_tagpair", op_fullstr_sub_tagpair, strlen(inline_input)},
+      {"fullstr_sub_tagpair_emphasis", op_fullstr_sub_tagpair_emphasis,
+       strlen(emphasis_input)},
+      {"convert_id_tag", op_convert_id_tag, strlen(heading_input)},
+      {"parse_markdown_links", op_parse_markdown_links, strlen(links_input)},
+      {"parse_markdown_images", op_parse_markdown_images,
+       strlen(images_input)},
+      {"parse_markdown_links_reference", op_parse_markdown_links_reference,
+       strlen(reference_input)},
+      {"is_html_start_tag", op_is_html_start_tag, strlen(html_tag_input)},
+      {"content_splitter", op_content_splitter, strlen(lines_input)},
+  };
+  size_t bench_count = sizeof(benches) / sizeof(benches[0]);
+
+  BaselineEntry *base_entries = NULL;
+  size_t base_count = 0;
+  if (baseline) {
+    base_count = load_baseline(baseline, &base_entries);
+  }
+
+  FILE *out = fopen(output, "w");
+  if (!out) {
+    perror("Failed to open output");
+    return 1;
+  }
+  fprintf(out, "{\n\"benchmarks\": [\n");
+
+  printf("%-32s %10s %12s %12s %12s", "benchmark", "bytes", "ns/op",
+         "bytes/op", "allocs/op");
+  if (baseline) {
+    printf(" %10s", "vs base");
+  }
+  printf("\n");
+
+  bool first = true;
+  for (size_t i = 0; i < bench_count; i++) {
+    const Bench *bench = &benches[i];
+    if (filter && strstr(bench->name, filter) == NULL) {
+      continue;
+    }
+
+    // Grow the batch until it runs long enough to time reliably
+    bench->op();
+    size_t iterations = 1;
+    while (run_batch(bench, iterations) < min_time_ns / 10) {
+      iterations *= 2;
+    }
+    iterations *= 10;
+
+    alloc_stats_reset();
+    double elapsed = run_batch(bench, iterations);
+    AllocStats stats = alloc_stats_get();
+
+    double ns_per_op = elapsed / iterations;
+    double bytes_per_op = (double)stats.bytes / iterations;
+    double allocs_per_op = (double)stats.allocs / iterations;
+
+    printf("%-32s %10zu %12.1f %12.1f %12.2f", bench->name, bench->input_bytes,
+           ns_per_op, bytes_per_op, allocs_per_op);
+    const BaselineEntry *base =
+        find_baseline(base_entries, base_count, bench->name);
+    if (base && base->ns_per_op > 0) {
+      printf(" %+9.1f%%", (ns_per_op / base->ns_per_op - 1) * 100);
+    }
+    printf("\n");
+
+    fprintf(out,
+            "%s{\"name\": \"%s\", \"input_bytes\": %zu, \"iterations\": %zu, "
+            "\"ns_per_op\": %.1f, \"bytes_per_op\": %.1f, "
+            "\"allocs_per_op\": %.2f}",
+            first ? "" : ",\n", bench->name, bench->input_bytes, iterations,
+            ns_per_op, bytes_per_op, allocs_per_op);
+    first = false;
+  }
+
+  fprintf(out, "\n]\n}\n");
+  fclose(out);
+  printf("\nResults written to %s\n", output);
+
+  free(base_entries);
+  free_inputs();
+  log_close();
+
+  return 0;
+}
@@ -0,0 +1,829 @@
+/* auto-generated: do not edit */
+/* head.html -> page_head */
+const unsigned char page_head[] = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74,
+  0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c,
+  0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20,
+  0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 0x46,
+  0x2d, 0x38, 0x22, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e,
+  0x50, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x20,
+  0x74, 0x69, 0x74, 0x6c, 0x65, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65,
+  0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+  0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e,
+  0x0a
+};
+const unsigned int page_head_len = 157;
+const unsigned char page_head_min[] = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74,
+  0x6d, 0x6c, 0x3e, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c, 0x68, 0x65,
+  0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61,
+  0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3e, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x63,
+  0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x20, 0x74, 0x69, 0x74, 0x6c,
+  0x65, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x3c, 0x6d, 0x65,
+  0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65,
+  0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+  0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65,
+  0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20,
+  0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e
+};
+const unsigned int page_head_min_len = 151;
+
+/* body.html+container-open.html -> page_body */
+const unsigned char page_body[] = {
+  0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64,
+  0x79, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72,
+  0x22, 0x3e, 0x0a
+};
+const unsigned int page_body_len = 39;
+const unsigned char page_body_min[] = {
+  0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62, 0x6f, 0x64, 0x79,
+  0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e
+};
+const unsigned int page_body_min_len = 36;
+
+/* highlight-load.html+body.html+theme-toggler.html+container-open.html -> page_body_styled */
+const unsigned char page_body_styled[] = {
+  0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x63, 0x64, 0x6e,
+  0x6a, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x66, 0x6c, 0x61, 0x72,
+  0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x61, 0x6a, 0x61, 0x78, 0x2f, 0x6c,
+  0x69, 0x62, 0x73, 0x2f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x2e, 0x6a, 0x73, 0x2f, 0x31, 0x31, 0x2e, 0x31, 0x31, 0x2e, 0x31,
+  0x2f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x6d,
+  0x69, 0x6e, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e,
+  0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x6e, 0x61, 0x76,
+  0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77,
+  0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30,
+  0x2f, 0x73, 0x76, 0x67, 0x22, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d, 0x22,
+  0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f,
+  0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34,
+  0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73,
+  0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61,
+  0x70, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x73, 0x74,
+  0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69,
+  0x6e, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d,
+  0x22, 0x4d, 0x31, 0x32, 0x20, 0x33, 0x76, 0x32, 0x2e, 0x32, 0x35, 0x6d,
+  0x36, 0x2e, 0x33, 0x36, 0x34, 0x2e, 0x33, 0x38, 0x36, 0x2d, 0x31, 0x2e,
+  0x35, 0x39, 0x31, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x4d, 0x32, 0x31,
+  0x20, 0x31, 0x32, 0x68, 0x2d, 0x32, 0x2e, 0x32, 0x35, 0x6d, 0x2d, 0x2e,
+  0x33, 0x38, 0x36, 0x20, 0x36, 0x2e, 0x33, 0x36, 0x34, 0x2d, 0x31, 0x2e,
+  0x35, 0x39, 0x31, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x4d, 0x31, 0x32,
+  0x20, 0x31, 0x38, 0x2e, 0x37, 0x35, 0x56, 0x32, 0x31, 0x6d, 0x2d, 0x34,
+  0x2e, 0x37, 0x37, 0x33, 0x2d, 0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x31,
+  0x2e, 0x35, 0x39, 0x31, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x4d, 0x35,
+  0x2e, 0x32, 0x35, 0x20, 0x31, 0x32, 0x48, 0x33, 0x6d, 0x34, 0x2e, 0x32,
+  0x32, 0x37, 0x2d, 0x34, 0x2e, 0x37, 0x37, 0x33, 0x4c, 0x35, 0x2e, 0x36,
+  0x33, 0x36, 0x20, 0x35, 0x2e, 0x36, 0x33, 0x36, 0x4d, 0x31, 0x35, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x32, 0x61, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x33,
+  0x2e, 0x37, 0x35, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x2d, 0x37, 0x2e,
+  0x35, 0x20, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x37,
+  0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x37, 0x2e, 0x35, 0x20,
+  0x30, 0x5a, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x76, 0x67,
+  0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77,
+  0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30,
+  0x2f, 0x73, 0x76, 0x67, 0x22, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d, 0x22,
+  0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f,
+  0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34,
+  0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x2d, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x74,
+  0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70,
+  0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69, 0x6e,
+  0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d, 0x22,
+  0x4d, 0x32, 0x31, 0x2e, 0x37, 0x35, 0x32, 0x20, 0x31, 0x35, 0x2e, 0x30,
+  0x30, 0x32, 0x41, 0x39, 0x2e, 0x37, 0x32, 0x20, 0x39, 0x2e, 0x37, 0x32,
+  0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x38, 0x20, 0x31, 0x35,
+  0x2e, 0x37, 0x35, 0x63, 0x2d, 0x35, 0x2e, 0x33, 0x38, 0x35, 0x20, 0x30,
+  0x2d, 0x39, 0x2e, 0x37, 0x35, 0x2d, 0x34, 0x2e, 0x33, 0x36, 0x35, 0x2d,
+  0x39, 0x2e, 0x37, 0x35, 0x2d, 0x39, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2d,
+  0x31, 0x2e, 0x33, 0x33, 0x2e, 0x32, 0x36, 0x36, 0x2d, 0x32, 0x2e, 0x35,
+  0x39, 0x37, 0x2e, 0x37, 0x34, 0x38, 0x2d, 0x33, 0x2e, 0x37, 0x35, 0x32,
+  0x41, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x39, 0x2e, 0x37, 0x35, 0x33,
+  0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x31, 0x31, 0x2e,
+  0x32, 0x35, 0x43, 0x33, 0x20, 0x31, 0x36, 0x2e, 0x36, 0x33, 0x35, 0x20,
+  0x37, 0x2e, 0x33, 0x36, 0x35, 0x20, 0x32, 0x31, 0x20, 0x31, 0x32, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x31, 0x61, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20,
+  0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20,
+  0x39, 0x2e, 0x30, 0x30, 0x32, 0x2d, 0x35, 0x2e, 0x39, 0x39, 0x38, 0x5a,
+  0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a,
+  0x3c, 0x2f, 0x6e, 0x61, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a
+};
+const unsigned int page_body_styled_len = 955;
+const unsigned char page_body_styled_min[] = {
+  0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x63, 0x64, 0x6e,
+  0x6a, 0x73, 0x2e, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x66, 0x6c, 0x61, 0x72,
+  0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x61, 0x6a, 0x61, 0x78, 0x2f, 0x6c,
+  0x69, 0x62, 0x73, 0x2f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x2e, 0x6a, 0x73, 0x2f, 0x31, 0x31, 0x2e, 0x31, 0x31, 0x2e, 0x31,
+  0x2f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x6d,
+  0x69, 0x6e, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c,
+  0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x6e, 0x61, 0x76, 0x3e, 0x3c, 0x73,
+  0x76, 0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e,
+  0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30, 0x2f, 0x73, 0x76, 0x67,
+  0x22, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65,
+  0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30,
+  0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x73, 0x74,
+  0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22,
+  0x31, 0x2e, 0x35, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d,
+  0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f,
+  0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x6f,
+  0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x22, 0x3e,
+  0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+  0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 0x3d, 0x22, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d,
+  0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x22, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20,
+  0x33, 0x76, 0x32, 0x2e, 0x32, 0x35, 0x6d, 0x36, 0x2e, 0x33, 0x36, 0x34,
+  0x2e, 0x33, 0x38, 0x36, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20, 0x31,
+  0x2e, 0x35, 0x39, 0x31, 0x4d, 0x32, 0x31, 0x20, 0x31, 0x32, 0x68, 0x2d,
+  0x32, 0x2e, 0x32, 0x35, 0x6d, 0x2d, 0x2e, 0x33, 0x38, 0x36, 0x20, 0x36,
+  0x2e, 0x33, 0x36, 0x34, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x2d, 0x31,
+  0x2e, 0x35, 0x39, 0x31, 0x4d, 0x31, 0x32, 0x20, 0x31, 0x38, 0x2e, 0x37,
+  0x35, 0x56, 0x32, 0x31, 0x6d, 0x2d, 0x34, 0x2e, 0x37, 0x37, 0x33, 0x2d,
+  0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20,
+  0x31, 0x2e, 0x35, 0x39, 0x31, 0x4d, 0x35, 0x2e, 0x32, 0x35, 0x20, 0x31,
+  0x32, 0x48, 0x33, 0x6d, 0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x34, 0x2e,
+  0x37, 0x37, 0x33, 0x4c, 0x35, 0x2e, 0x36, 0x33, 0x36, 0x20, 0x35, 0x2e,
+  0x36, 0x33, 0x36, 0x4d, 0x31, 0x35, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x32,
+  0x61, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x30,
+  0x20, 0x31, 0x20, 0x31, 0x2d, 0x37, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x33,
+  0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x20, 0x30,
+  0x20, 0x31, 0x20, 0x37, 0x2e, 0x35, 0x20, 0x30, 0x5a, 0x22, 0x20, 0x2f,
+  0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x3c, 0x73, 0x76, 0x67, 0x20,
+  0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+  0x2f, 0x32, 0x30, 0x30, 0x30, 0x2f, 0x73, 0x76, 0x67, 0x22, 0x20, 0x66,
+  0x69, 0x6c, 0x6c, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x76,
+  0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20,
+  0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b,
+  0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x2e, 0x35,
+  0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x22, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c,
+  0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x64, 0x61, 0x72, 0x6b,
+  0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74,
+  0x68, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e,
+  0x65, 0x63, 0x61, 0x70, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22,
+  0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65,
+  0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22,
+  0x20, 0x64, 0x3d, 0x22, 0x4d, 0x32, 0x31, 0x2e, 0x37, 0x35, 0x32, 0x20,
+  0x31, 0x35, 0x2e, 0x30, 0x30, 0x32, 0x41, 0x39, 0x2e, 0x37, 0x32, 0x20,
+  0x39, 0x2e, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31,
+  0x38, 0x20, 0x31, 0x35, 0x2e, 0x37, 0x35, 0x63, 0x2d, 0x35, 0x2e, 0x33,
+  0x38, 0x35, 0x20, 0x30, 0x2d, 0x39, 0x2e, 0x37, 0x35, 0x2d, 0x34, 0x2e,
+  0x33, 0x36, 0x35, 0x2d, 0x39, 0x2e, 0x37, 0x35, 0x2d, 0x39, 0x2e, 0x37,
+  0x35, 0x20, 0x30, 0x2d, 0x31, 0x2e, 0x33, 0x33, 0x2e, 0x32, 0x36, 0x36,
+  0x2d, 0x32, 0x2e, 0x35, 0x39, 0x37, 0x2e, 0x37, 0x34, 0x38, 0x2d, 0x33,
+  0x2e, 0x37, 0x35, 0x32, 0x41, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x39,
+  0x2e, 0x37, 0x35, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33,
+  0x20, 0x31, 0x31, 0x2e, 0x32, 0x35, 0x43, 0x33, 0x20, 0x31, 0x36, 0x2e,
+  0x36, 0x33, 0x35, 0x20, 0x37, 0x2e, 0x33, 0x36, 0x35, 0x20, 0x32, 0x31,
+  0x20, 0x31, 0x32, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x31, 0x61, 0x39, 0x2e,
+  0x37, 0x35, 0x33, 0x20, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x30, 0x20,
+  0x30, 0x20, 0x30, 0x20, 0x39, 0x2e, 0x30, 0x30, 0x32, 0x2d, 0x35, 0x2e,
+  0x39, 0x39, 0x38, 0x5a, 0x22, 0x20, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76,
+  0x67, 0x3e, 0x3c, 0x2f, 0x6e, 0x61, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74,
+  0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e
+};
+const unsigned int page_body_styled_min_len = 943;
+
+/* body.html+theme-toggler.html+container-open.html -> page_body_highlighted */
+const unsigned char page_body_highlighted[] = {
+  0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64,
+  0x79, 0x3e, 0x0a, 0x3c, 0x6e, 0x61, 0x76, 0x3e, 0x0a, 0x3c, 0x73, 0x76,
+  0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30, 0x2f, 0x73, 0x76, 0x67, 0x22,
+  0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22,
+  0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20,
+  0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31,
+  0x2e, 0x35, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x22,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
+  0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x6f, 0x67,
+  0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x22, 0x3e, 0x0a,
+  0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+  0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 0x3d, 0x22, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d,
+  0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x22, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20,
+  0x33, 0x76, 0x32, 0x2e, 0x32, 0x35, 0x6d, 0x36, 0x2e, 0x33, 0x36, 0x34,
+  0x2e, 0x33, 0x38, 0x36, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20, 0x31,
+  0x2e, 0x35, 0x39, 0x31, 0x4d, 0x32, 0x31, 0x20, 0x31, 0x32, 0x68, 0x2d,
+  0x32, 0x2e, 0x32, 0x35, 0x6d, 0x2d, 0x2e, 0x33, 0x38, 0x36, 0x20, 0x36,
+  0x2e, 0x33, 0x36, 0x34, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x2d, 0x31,
+  0x2e, 0x35, 0x39, 0x31, 0x4d, 0x31, 0x32, 0x20, 0x31, 0x38, 0x2e, 0x37,
+  0x35, 0x56, 0x32, 0x31, 0x6d, 0x2d, 0x34, 0x2e, 0x37, 0x37, 0x33, 0x2d,
+  0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20,
+  0x31, 0x2e, 0x35, 0x39, 0x31, 0x4d, 0x35, 0x2e, 0x32, 0x35, 0x20, 0x31,
+  0x32, 0x48, 0x33, 0x6d, 0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x34, 0x2e,
+  0x37, 0x37, 0x33, 0x4c, 0x35, 0x2e, 0x36, 0x33, 0x36, 0x20, 0x35, 0x2e,
+  0x36, 0x33, 0x36, 0x4d, 0x31, 0x35, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x32,
+  0x61, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x30,
+  0x20, 0x31, 0x20, 0x31, 0x2d, 0x37, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x33,
+  0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x20, 0x30,
+  0x20, 0x31, 0x20, 0x37, 0x2e, 0x35, 0x20, 0x30, 0x5a, 0x22, 0x20, 0x2f,
+  0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x3c, 0x73, 0x76,
+  0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30, 0x2f, 0x73, 0x76, 0x67, 0x22,
+  0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22,
+  0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20,
+  0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31,
+  0x2e, 0x35, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x22,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
+  0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x6f, 0x67,
+  0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x64, 0x61,
+  0x72, 0x6b, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x3c,
+  0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d,
+  0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70, 0x3d, 0x22, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c,
+  0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x22, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x32, 0x31, 0x2e, 0x37,
+  0x35, 0x32, 0x20, 0x31, 0x35, 0x2e, 0x30, 0x30, 0x32, 0x41, 0x39, 0x2e,
+  0x37, 0x32, 0x20, 0x39, 0x2e, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20,
+  0x31, 0x20, 0x31, 0x38, 0x20, 0x31, 0x35, 0x2e, 0x37, 0x35, 0x63, 0x2d,
+  0x35, 0x2e, 0x33, 0x38, 0x35, 0x20, 0x30, 0x2d, 0x39, 0x2e, 0x37, 0x35,
+  0x2d, 0x34, 0x2e, 0x33, 0x36, 0x35, 0x2d, 0x39, 0x2e, 0x37, 0x35, 0x2d,
+  0x39, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2d, 0x31, 0x2e, 0x33, 0x33, 0x2e,
+  0x32, 0x36, 0x36, 0x2d, 0x32, 0x2e, 0x35, 0x39, 0x37, 0x2e, 0x37, 0x34,
+  0x38, 0x2d, 0x33, 0x2e, 0x37, 0x35, 0x32, 0x41, 0x39, 0x2e, 0x37, 0x35,
+  0x33, 0x20, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20,
+  0x30, 0x20, 0x33, 0x20, 0x31, 0x31, 0x2e, 0x32, 0x35, 0x43, 0x33, 0x20,
+  0x31, 0x36, 0x2e, 0x36, 0x33, 0x35, 0x20, 0x37, 0x2e, 0x33, 0x36, 0x35,
+  0x20, 0x32, 0x31, 0x20, 0x31, 0x32, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x31,
+  0x61, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x39, 0x2e, 0x37, 0x35, 0x33,
+  0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x2e, 0x30, 0x30, 0x32,
+  0x2d, 0x35, 0x2e, 0x39, 0x39, 0x38, 0x5a, 0x22, 0x20, 0x2f, 0x3e, 0x0a,
+  0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x3c, 0x2f, 0x6e, 0x61, 0x76,
+  0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22,
+  0x3e, 0x0a
+};
+const unsigned int page_body_highlighted_len = 854;
+const unsigned char page_body_highlighted_min[] = {
+  0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62, 0x6f, 0x64, 0x79,
+  0x3e, 0x3c, 0x6e, 0x61, 0x76, 0x3e, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x78,
+  0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x32, 0x30, 0x30, 0x30, 0x2f, 0x73, 0x76, 0x67, 0x22, 0x20, 0x66, 0x69,
+  0x6c, 0x6c, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x76, 0x69,
+  0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32,
+  0x34, 0x20, 0x32, 0x34, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x22,
+  0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x22, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+  0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74,
+  0x68, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e,
+  0x65, 0x63, 0x61, 0x70, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22,
+  0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65,
+  0x6a, 0x6f, 0x69, 0x6e, 0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22,
+  0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20, 0x33, 0x76, 0x32, 0x2e,
+  0x32, 0x35, 0x6d, 0x36, 0x2e, 0x33, 0x36, 0x34, 0x2e, 0x33, 0x38, 0x36,
+  0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20, 0x31, 0x2e, 0x35, 0x39, 0x31,
+  0x4d, 0x32, 0x31, 0x20, 0x31, 0x32, 0x68, 0x2d, 0x32, 0x2e, 0x32, 0x35,
+  0x6d, 0x2d, 0x2e, 0x33, 0x38, 0x36, 0x20, 0x36, 0x2e, 0x33, 0x36, 0x34,
+  0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31,
+  0x4d, 0x31, 0x32, 0x20, 0x31, 0x38, 0x2e, 0x37, 0x35, 0x56, 0x32, 0x31,
+  0x6d, 0x2d, 0x34, 0x2e, 0x37, 0x37, 0x33, 0x2d, 0x34, 0x2e, 0x32, 0x32,
+  0x37, 0x2d, 0x31, 0x2e, 0x35, 0x39, 0x31, 0x20, 0x31, 0x2e, 0x35, 0x39,
+  0x31, 0x4d, 0x35, 0x2e, 0x32, 0x35, 0x20, 0x31, 0x32, 0x48, 0x33, 0x6d,
+  0x34, 0x2e, 0x32, 0x32, 0x37, 0x2d, 0x34, 0x2e, 0x37, 0x37, 0x33, 0x4c,
+  0x35, 0x2e, 0x36, 0x33, 0x36, 0x20, 0x35, 0x2e, 0x36, 0x33, 0x36, 0x4d,
+  0x31, 0x35, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x32, 0x61, 0x33, 0x2e, 0x37,
+  0x35, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31,
+  0x2d, 0x37, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x37,
+  0x2e, 0x35, 0x20, 0x30, 0x5a, 0x22, 0x20, 0x2f, 0x3e, 0x3c, 0x2f, 0x73,
+  0x76, 0x67, 0x3e, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+  0x73, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+  0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30,
+  0x30, 0x2f, 0x73, 0x76, 0x67, 0x22, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x3d,
+  0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42,
+  0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32,
+  0x34, 0x22, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x22, 0x20, 0x73, 0x74,
+  0x72, 0x6f, 0x6b, 0x65, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x2d, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x73, 0x74,
+  0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x63, 0x61, 0x70,
+  0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x73, 0x74, 0x72,
+  0x6f, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x6a, 0x6f, 0x69, 0x6e,
+  0x3d, 0x22, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x20, 0x64, 0x3d, 0x22,
+  0x4d, 0x32, 0x31, 0x2e, 0x37, 0x35, 0x32, 0x20, 0x31, 0x35, 0x2e, 0x30,
+  0x30, 0x32, 0x41, 0x39, 0x2e, 0x37, 0x32, 0x20, 0x39, 0x2e, 0x37, 0x32,
+  0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x31, 0x38, 0x20, 0x31, 0x35,
+  0x2e, 0x37, 0x35, 0x63, 0x2d, 0x35, 0x2e, 0x33, 0x38, 0x35, 0x20, 0x30,
+  0x2d, 0x39, 0x2e, 0x37, 0x35, 0x2d, 0x34, 0x2e, 0x33, 0x36, 0x35, 0x2d,
+  0x39, 0x2e, 0x37, 0x35, 0x2d, 0x39, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2d,
+  0x31, 0x2e, 0x33, 0x33, 0x2e, 0x32, 0x36, 0x36, 0x2d, 0x32, 0x2e, 0x35,
+  0x39, 0x37, 0x2e, 0x37, 0x34, 0x38, 0x2d, 0x33, 0x2e, 0x37, 0x35, 0x32,
+  0x41, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x39, 0x2e, 0x37, 0x35, 0x33,
+  0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x31, 0x31, 0x2e,
+  0x32, 0x35, 0x43, 0x33, 0x20, 0x31, 0x36, 0x2e, 0x36, 0x33, 0x35, 0x20,
+  0x37, 0x2e, 0x33, 0x36, 0x35, 0x20, 0x32, 0x31, 0x20, 0x31, 0x32, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x31, 0x61, 0x39, 0x2e, 0x37, 0x35, 0x33, 0x20,
+  0x39, 0x2e, 0x37, 0x35, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20,
+  0x39, 0x2e, 0x30, 0x30, 0x32, 0x2d, 0x35, 0x2e, 0x39, 0x39, 0x38, 0x5a,
+  0x22, 0x20, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x3c, 0x2f,
+  0x6e, 0x61, 0x76, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65,
+  0x72, 0x22, 0x3e
+};
+const unsigned int page_body_highlighted_min_len = 843;
+
+/* container-close.html+end.html -> page_tail */
+const unsigned char page_tail[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64,
+  0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a
+};
+const unsigned int page_tail_len = 23;
+const unsigned char page_tail_min[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79,
+  0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e
+};
+const unsigned int page_tail_min_len = 20;
+
+/* container-close.html+highlight-run.html -> page_tail_styled */
+const unsigned char page_tail_styled[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x68, 0x6c, 0x6a, 0x73, 0x2e, 0x68, 0x69, 0x67, 0x68,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x41, 0x6c, 0x6c, 0x28, 0x29, 0x3b, 0x3c,
+  0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a
+};
+const unsigned int page_tail_styled_len = 45;
+const unsigned char page_tail_styled_min[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x68, 0x6c, 0x6a, 0x73, 0x2e, 0x68, 0x69, 0x67, 0x68, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x41, 0x6c, 0x6c, 0x28, 0x29, 0x3b, 0x3c, 0x2f,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e
+};
+const unsigned int page_tail_styled_min_len = 43;
+
+/* container-close.html -> page_tail_highlighted */
+const unsigned char page_tail_highlighted[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a
+};
+const unsigned int page_tail_highlighted_len = 7;
+const unsigned char page_tail_highlighted_min[] = {
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e
+};
+const unsigned int page_tail_highlighted_min_len = 6;
+
+/* script-open.html+theme-init.js+script-close.html+script-open.html+theme-toggle.js+script-close.html -> page_theme_script */
+const unsigned char page_theme_script[] = {
+  0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x28, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x0a,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20,
+  0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61,
+  0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x44, 0x61,
+  0x72, 0x6b, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x28, 0x27,
+  0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x2d, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x3a, 0x20, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x29, 0x27, 0x29, 0x2e, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x73, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64,
+  0x20, 0x7c, 0x7c, 0x20, 0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73,
+  0x44, 0x61, 0x72, 0x6b, 0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x29,
+  0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62,
+  0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73,
+  0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x27, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x27, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20,
+  0x3d, 0x3d, 0x3d, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29,
+  0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74,
+  0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x6f, 0x72, 0x28, 0x27, 0x2e, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42,
+  0x74, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x64, 0x61, 0x72, 0x6b, 0x2d, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x27, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x20, 0x7b, 0x0a, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64,
+  0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x0a,
+  0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e,
+  0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+  0x7b, 0x0a, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42,
+  0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+  0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e,
+  0x27, 0x29, 0x3b, 0x0a, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65,
+  0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c,
+  0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x7d, 0x29, 0x28, 0x29, 0x3b, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x73, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x2e, 0x74, 0x6f, 0x67, 0x67,
+  0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61,
+  0x63, 0x68, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3e, 0x20,
+  0x7b, 0x0a, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45,
+  0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+  0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x28, 0x29,
+  0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x63, 0x6f,
+  0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x28, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x29, 0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x3b, 0x0a,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x3d,
+  0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3d, 0x3d,
+  0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3f, 0x20, 0x27,
+  0x64, 0x61, 0x72, 0x6b, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x27, 0x3b, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74,
+  0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65,
+  0x6d, 0x28, 0x27, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x2c, 0x20, 0x6e,
+  0x65, 0x78, 0x74, 0x29, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73,
+  0x65, 0x74, 0x2e, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65,
+  0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f,
+  0x67, 0x67, 0x6c, 0x65, 0x28, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27,
+  0x29, 0x3b, 0x0a, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f,
+  0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x74,
+  0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74,
+  0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x27, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x29,
+  0x3b, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a
+};
+const unsigned int page_theme_script_len = 1212;
+const unsigned char page_theme_script_min[] = {
+  0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x28, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x3d, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x44, 0x61, 0x72, 0x6b, 0x20,
+  0x3d, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x28, 0x27, 0x28, 0x70, 0x72,
+  0x65, 0x66, 0x65, 0x72, 0x73, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x2d,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x3a, 0x20, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x29, 0x27, 0x29, 0x2e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73,
+  0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x20, 0x3d, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x7c, 0x7c, 0x20,
+  0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x44, 0x61, 0x72, 0x6b,
+  0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3a,
+  0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x29, 0x3b, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67,
+  0x67, 0x6c, 0x65, 0x28, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x27,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x3b, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74,
+  0x61, 0x73, 0x65, 0x74, 0x2e, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d,
+  0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65,
+  0x6d, 0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65,
+  0x6d, 0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x64, 0x61, 0x72,
+  0x6b, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x69, 0x66,
+  0x20, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20,
+  0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x20, 0x7b, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64,
+  0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b,
+  0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e,
+  0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x27, 0x29, 0x3b, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+  0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e,
+  0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61,
+  0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29,
+  0x3b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42,
+  0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+  0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27, 0x68, 0x69, 0x64,
+  0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x7d, 0x7d, 0x29, 0x28, 0x29, 0x3b,
+  0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x2e,
+  0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x27, 0x29, 0x3b, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f,
+  0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20,
+  0x3d, 0x3e, 0x20, 0x7b, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x2e, 0x61, 0x64,
+  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20,
+  0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79,
+  0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x63,
+  0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x28, 0x27, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x27, 0x29, 0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x3b,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x3d,
+  0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3d, 0x3d,
+  0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3f, 0x20, 0x27,
+  0x64, 0x61, 0x72, 0x6b, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x27, 0x3b, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d,
+  0x28, 0x27, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x2c, 0x20, 0x6e, 0x65,
+  0x78, 0x74, 0x29, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
+  0x2e, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+  0x28, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x3b, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68,
+  0x28, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x74, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+  0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x29, 0x3b,
+  0x7d, 0x29, 0x3b, 0x7d, 0x29, 0x3b, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e
+};
+const unsigned int page_theme_script_min_len = 1179;
+
+/* end.html -> page_end */
+const unsigned char page_end[] = {
+  0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74,
+  0x6d, 0x6c, 0x3e, 0x0a
+};
+const unsigned int page_end_len = 16;
+const unsigned char page_end_min[] = {
+  0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d,
+  0x6c, 0x3e
+};
+const unsigned int page_end_min_len = 14;
+
+/* theme-init.js+theme-toggle.js -> theme_script_js */
+const unsigned char theme_script_js[] = {
+  0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x61, 0x76,
+  0x65, 0x64, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74,
+  0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65,
+  0x6d, 0x28, 0x27, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72,
+  0x73, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x6e, 0x64,
+  0x6f, 0x77, 0x2e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x4d, 0x65, 0x64, 0x69,
+  0x61, 0x28, 0x27, 0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x2d,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x2d, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x65,
+  0x3a, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x29, 0x27, 0x29, 0x2e, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x64, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x70, 0x72, 0x65, 0x66,
+  0x65, 0x72, 0x73, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x3f, 0x20, 0x27, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72,
+  0x6b, 0x27, 0x29, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28,
+  0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x29, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65,
+  0x74, 0x2e, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x20,
+  0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d,
+  0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65,
+  0x6d, 0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x2e, 0x64, 0x61, 0x72,
+  0x6b, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x69,
+  0x66, 0x20, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3d, 0x3d,
+  0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x20, 0x7b, 0x0a,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74,
+  0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e,
+  0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27,
+  0x29, 0x3b, 0x0a, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65,
+  0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73,
+  0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27, 0x68, 0x69,
+  0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x7b, 0x0a, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65,
+  0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c,
+  0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64,
+  0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x7d, 0x29, 0x28, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65,
+  0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c,
+  0x6c, 0x28, 0x27, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+  0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c,
+  0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20,
+  0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69,
+  0x6e, 0x73, 0x28, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x20,
+  0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3a, 0x20,
+  0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x27, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x27, 0x20, 0x3f, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b,
+  0x27, 0x20, 0x3a, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x3b,
+  0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67,
+  0x65, 0x2e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x27, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x27, 0x2c, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x29,
+  0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+  0x28, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x3b, 0x0a, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63,
+  0x68, 0x28, 0x74, 0x20, 0x3d, 0x3e, 0x20, 0x74, 0x2e, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c,
+  0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x29,
+  0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a
+};
+const unsigned int theme_script_js_len = 1174;
+const unsigned char theme_script_js_min[] = {
+  0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29,
+  0x20, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x64, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d,
+  0x28, 0x27, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x44,
+  0x61, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+  0x2e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x28,
+  0x27, 0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x2d, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x2d, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x3a, 0x20,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x29, 0x27, 0x29, 0x2e, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x65, 0x73, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64,
+  0x20, 0x7c, 0x7c, 0x20, 0x28, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73,
+  0x44, 0x61, 0x72, 0x6b, 0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x29,
+  0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f,
+  0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+  0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28, 0x27, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x27, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d,
+  0x3d, 0x3d, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x3b,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x3b, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+  0x63, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65,
+  0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27,
+  0x2e, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65,
+  0x27, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x61, 0x72,
+  0x6b, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65,
+  0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27,
+  0x2e, 0x64, 0x61, 0x72, 0x6b, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27,
+  0x29, 0x3b, 0x69, 0x66, 0x20, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20,
+  0x3d, 0x3d, 0x3d, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29,
+  0x20, 0x7b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68, 0x65, 0x6d, 0x65,
+  0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73,
+  0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x27, 0x29, 0x3b, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d,
+  0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69,
+  0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27, 0x68,
+  0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x7d, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x7b, 0x64, 0x61, 0x72, 0x6b, 0x54, 0x68, 0x65, 0x6d,
+  0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69,
+  0x73, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x27, 0x29, 0x3b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x54, 0x68,
+  0x65, 0x6d, 0x65, 0x42, 0x74, 0x6e, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28,
+  0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x3b, 0x7d, 0x7d,
+  0x29, 0x28, 0x29, 0x3b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x2e, 0x74,
+  0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27,
+  0x29, 0x3b, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72,
+  0x45, 0x61, 0x63, 0x68, 0x28, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d,
+  0x3e, 0x20, 0x7b, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x2e, 0x61, 0x64, 0x64,
+  0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+  0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x28,
+  0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x63, 0x6f,
+  0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x28, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x29, 0x20, 0x3f, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x27, 0x20, 0x3a, 0x20, 0x27, 0x64, 0x61, 0x72, 0x6b, 0x27, 0x3b, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x3d, 0x3d, 0x20,
+  0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x20, 0x3f, 0x20, 0x27, 0x64,
+  0x61, 0x72, 0x6b, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x6c, 0x69, 0x67, 0x68,
+  0x74, 0x27, 0x3b, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28,
+  0x27, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x27, 0x2c, 0x20, 0x6e, 0x65, 0x78,
+  0x74, 0x29, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2e,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x74,
+  0x68, 0x65, 0x6d, 0x65, 0x3b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28,
+  0x27, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x27, 0x29, 0x3b, 0x74, 0x68, 0x65,
+  0x6d, 0x65, 0x73, 0x2e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
+  0x74, 0x20, 0x3d, 0x3e, 0x20, 0x74, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x4c, 0x69, 0x73, 0x74, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x28,
+  0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x27, 0x29, 0x29, 0x3b, 0x7d,
+  0x29, 0x3b, 0x7d, 0x29, 0x3b
+};
+const unsigned int theme_script_js_min_len = 1145;
+
@@ -0,0 +1,44 @@
+/* auto-generated: do not edit */
+#ifndef PAGE_HTML_H
+#define PAGE_HTML_H
+extern const unsigned char page_head[];
+extern const unsigned int  page_head_len;
+extern const unsigned char page_head_min[];
+extern const unsigned int  page_head_min_len;
+extern const unsigned char page_body[];
+extern const unsigned int  page_body_len;
+extern const unsigned char page_body_min[];
+extern const unsigned int  page_body_min_len;
+extern const unsigned char page_body_styled[];
+extern const unsigned int  page_body_styled_len;
+extern const unsigned char page_body_styled_min[];
+extern const unsigned int  page_body_styled_min_len;
+extern const unsigned char page_body_highlighted[];
+extern const unsigned int  page_body_highlighted_len;
+extern const unsigned char page_body_highlighted_min[];
+extern const unsigned int  page_body_highlighted_min_len;
+extern const unsigned char page_tail[];
+extern const unsigned int  page_tail_len;
+extern const unsigned char page_tail_min[];
+extern const unsigned int  page_tail_min_len;
+extern const unsigned char page_tail_styled[];
+extern const unsigned int  page_tail_styled_len;
+extern const unsigned char page_tail_styled_min[];
+extern const unsigned int  page_tail_styled_min_len;
+extern const unsigned char page_tail_highlighted[];
+extern const unsigned int  page_tail_highlighted_len;
+extern const unsigned char page_tail_highlighted_min[];
+extern const unsigned int  page_tail_highlighted_min_len;
+extern const unsigned char page_theme_script[];
+extern const unsigned int  page_theme_script_len;
+extern const unsigned char page_theme_script_min[];
+extern const unsigned int  page_theme_script_min_len;
+extern const unsigned char page_end[];
+extern const unsigned int  page_end_len;
+extern const unsigned char page_end_min[];
+extern const unsigned int  page_end_min_len;
+extern const unsigned char theme_script_js[];
+extern const unsigned int  theme_script_js_len;
+extern const unsigned char theme_script_js_min[];
+extern const unsigned int  theme_script_js_min_len;
+#endif
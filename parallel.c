@@ -0,0 +1,535 @@
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "html_writer.h"
+#include "parallel.h"
+#include "stats.h"
+#include "trace.h"
+
+// Chunks per thread for block parsing, each seam costs a short sequential
+// re-parse so these are fewer and larger than the render ranges
+#define CHUNKS_PER_THREAD 4
+
+// Result of parsing the lines from start on a reader of its own. The chunk
+// stops at the first block starting at or after end, which is kept pending
+// along with the reader so the seam repair can continue the parse.
+typedef struct {
+  int start;
+  int end;
+  MDBlock **blocks; // complete top level blocks, not linked yet
+  int *starts;      // line each block starts at
+  size_t count;
+  size_t capacity;
+  MDBlock *pending;
+  int pending_start; // line count when nothing is pending
+  PeekReader *reader;
+  bool failed;
+} Chunk;
+
+typedef struct {
+  MDSource *source;
+  MDLinkReference *refs;
+  Chunk *chunks;
+} ChunkJob;
+
+static int chunk_push(Chunk *chunk, MDBlock *block, int start) {
+  if (chunk->count == chunk->capacity) {
+    size_t capacity = chunk->capacity ? chunk->capacity * 2 : 64;
+    MDBlock **blocks = realloc(chunk->blocks, capacity * sizeof(MDBlock *));
+    if (!blocks) {
+      perror("Unable to reallocate chunk blocks");
+      return -1;
+    }
+    chunk->blocks = blocks;
+    int *starts = realloc(chunk->starts, capacity * sizeof(int));
+    if (!starts) {
+      perror("Unable to reallocate chunk starts");
+      return -1;
+    }
+    chunk->starts = starts;
+    chunk->capacity = capacity;
+  }
+  chunk->blocks[chunk->count] = block;
+  chunk->starts[chunk->count] = start;
+  chunk->count++;
+  return 0;
+}
+
+static void free_chunk(Chunk *chunk) {
+  for (size_t i = 0; i < chunk->count; i++) {
+    free_mdblocks(chunk->blocks[i]);
+  }
+  free_mdblocks(chunk->pending);
+  free_peek_reader(chunk->reader);
+  free(chunk->blocks);
+  free(chunk->starts);
+  *chunk = (Chunk){0};
+}
+
+// parse_chunk speculates that no block spans the chunk start and parses it
+// the way document_block_parsing does, without the previous block
+static void parse_chunk(void *ctx, size_t index) {
+  ChunkJob *job = ctx;
+  Chunk *chunk = &job->chunks[index];
+  MDSource *source = job->source;
+
+  TRACE_BEGIN("parse_chunk");
+  STATS_BEGIN(PHASE_BLOCK);
+  chunk->pending_start = source->line_count;
+  chunk->reader = new_peek_reader_from_source_range(source, chunk->start,
+                                                    DEFAULT_PEEK_COUNT);
+  if (!chunk->reader) {
+    fprintf(stderr, "Failed to create peek reader\n");
+    chunk->failed = true;
+  }
+
+  MDBlock *tail_block = NULL;
+  int tail_start = chunk->start;
+  while (!chunk->failed && chunk->reader->count > 0) {
+    int line = chunk->start + peek_reader_line_index(chunk->reader);
+    MDBlock *new_block =
+        block_parsing(NULL, tail_block, chunk->reader, job->refs);
+    if (new_block == NULL) {
+      continue;
+    }
+
+    if (tail_block != NULL && chunk_push(chunk, tail_block, tail_start) != 0) {
+      free_mdblocks(tail_block);
+      free_mdblocks(new_block);
+      tail_block = NULL;
+      chunk->failed = true;
+      break;
+    }
+    tail_block = NULL;
+    if (line >= chunk->end) {
+      chunk->pending = new_block;
+      chunk->pending_start = line;
+      break;
+    }
+    tail_block = new_block;
+    tail_start = line;
+  }
+
+  if (tail_block != NULL) {
+    child_parsing_exec(job->refs, tail_block);
+    if (chunk_push(chunk, tail_block, tail_start) != 0) {
+      free_mdblocks(tail_block);
+      chunk->failed = true;
+    }
+  }
+  STATS_END();
+
+  if (trace_enabled) {
+    trace_end("parse_chunk",
+              "\"start\": %d, \"end\": %d, \"blocks\": %zu, \"overrun\": %d",
+              chunk->start, chunk->end, chunk->count,
+              chunk->pending ? chunk->pending_start - chunk->end : 0);
+  }
+}
+
+// A chunk may start at a line after a blank line that begins with a letter or
+// a heading marker, which rarely continues the block before it. Seams at any
+// other line would mostly end up re-parsed.
+static bool is_chunk_start(char **lines, int i) {
+  unsigned char c = (unsigned char)lines[i][0];
+  return is_empty_or_whitespace(lines[i - 1]) && (isalpha(c) || c == '#');
+}
+
+static Chunk *split_chunks(const MDSource *source, int chunk_lines,
+                           size_t *count) {
+  size_t capacity = source->line_count / chunk_lines + 1;
+  Chunk *chunks = calloc(capacity, sizeof(Chunk));
+  if (!chunks) {
+    perror("calloc failed");
+    return NULL;
+  }
+
+  size_t n = 0;
+  chunks[n++].start = 0;
+  int line = chunk_lines;
+  while (line < source->line_count && n < capacity) {
+    while (line < source->line_count && !is_chunk_start(source->lines, line)) {
+      line++;
+    }
+    if (line >= source->line_count) {
+      break;
+    }
+    chunks[n - 1].end = line;
+    chunks[n++].start = line;
+    line += chunk_lines;
+  }
+  chunks[n - 1].end = source->line_count;
+
+  *count = n;
+  return chunks;
+}
+
+static long find_block_start(const Chunk *chunk, int line) {
+  size_t lo = 0;
+  size_t hi = chunk->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (chunk->starts[mid] < line) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo < chunk->count && chunk->starts[lo] == line ? (long)lo : -1;
+}
+
+// Line the block after blocks[i] starts at, line count at the end of input
+static int next_block_start(const Chunk *chunk, size_t i) {
+  return i + 1 < chunk->count ? chunk->starts[i + 1] : chunk->pending_start;
+}
+
+// continue_block parses lines into block until the next block starts, which
+// is returned with its line in next_start. Returns NULL at the end of input.
+static MDBlock *continue_block(MDLinkReference *refs, PeekReader *reader,
+                               int base, int line_count, MDBlock *block,
+                               int *next_start) {
+  while (reader->count > 0) {
+    int line = base + peek_reader_line_index(reader);
+    MDBlock *new_block = block_parsing(NULL, block, reader, refs);
+    if (new_block != NULL) {
+      *next_start = line;
+      return new_block;
+    }
+  }
+  child_parsing_exec(refs, block);
+  *next_start = line_count;
+  return NULL;
+}
+
+typedef struct {
+  MDBlock *head;
+  MDBlock *tail;
+  // Parse state at the end of the list
+  MDBlock *pending;
+  int pending_start;
+  PeekReader *reader;
+  int base; // line the reader starts at
+} Stitch;
+
+static void stitch_append(Stitch *stitch, MDBlock *block) {
+  if (stitch->head == NULL) {
+    stitch->head = block;
+  } else {
+    stitch->tail->next = block;
+  }
+  stitch->tail = block;
+}
+
+// stitch_adopt appends the blocks of chunk from first on and takes over its
+// parse state, the blocks before first are freed
+static void stitch_adopt(Stitch *stitch, Chunk *chunk, size_t first) {
+  for (size_t i = first; i < chunk->count; i++) {
+    stitch_append(stitch, chunk->blocks[i]);
+  }
+  chunk->count = first;
+  free_peek_reader(stitch->reader);
+  stitch->reader = chunk->reader;
+  stitch->base = chunk->start;
+  stitch->pending = chunk->pending;
+  stitch->pending_start = chunk->pending_start;
+  chunk->reader = NULL;
+  chunk->pending = NULL;
+  free_chunk(chunk);
+}
+
+// stitch_chunks links the chunks in order and repairs every seam. From the
+// pending block of a chunk the parse goes on sequentially, a block at a
+// time, until it completes a block equal to one the next chunk parsed at the
+// same line and the blocks after both start at the same line. The parse
+// state there matches the next chunk's, so the rest of that chunk is taken
+// as is. Chunks the sequential parse runs past are dropped.
+static MDBlock *stitch_chunks(MDLinkReference *refs, int line_count,
+                              Chunk *chunks, size_t count) {
+  Stitch stitch = {0};
+  size_t reparsed = 0;
+  stitch_adopt(&stitch, &chunks[0], 0);
+  size_t next = 1;
+
+  while (stitch.pending != NULL) {
+    while (next < count && chunks[next].pending != NULL &&
+           stitch.pending_start >= chunks[next].pending_start) {
+      free_chunk(&chunks[next++]);
+    }
+
+    int next_start;
+    MDBlock *new_block =
+        continue_block(refs, stitch.reader, stitch.base, line_count,
+                       stitch.pending, &next_start);
+    if (next < count) {
+      Chunk *chunk = &chunks[next];
+      long first = find_block_start(chunk, stitch.pending_start);
+      if (first >= 0 && next_start == next_block_start(chunk, first) &&
+          mdblock_equal(stitch.pending, chunk->blocks[first])) {
+        free_mdblocks(stitch.pending);
+        free_mdblocks(new_block);
+        stitch_adopt(&stitch, chunk, first);
+        next++;
+        continue;
+      }
+    }
+
+    stitch_append(&stitch, stitch.pending);
+    stitch.pending = new_block;
+    stitch.pending_start = next_start;
+    reparsed++;
+  }
+
+  free_peek_reader(stitch.reader);
+  for (; next < count; next++) {
+    free_chunk(&chunks[next]);
+  }
+  LOGF("stitched %zu chunks, %zu blocks re-parsed\n", count, reparsed);
+  return stitch.head;
+}
+
+// parse_blocks_parallel builds the same top level block list as
+// document_block_parsing by parsing chunks of the source concurrently.
+// Chunks span at least chunk_lines lines, 0 sizes them for the pool.
+// Inline parsing must be deferred. Returns 0 on success, -1 on error.
+int parse_blocks_parallel(ThreadPool *pool, MDSource *source,
+                          MDLinkReference *refs, int chunk_lines,
+                          MDBlock **head) {
+  if (chunk_lines <= 0) {
+    int threads = thread_pool_size(pool);
+    chunk_lines = source->line_count / (threads * CHUNKS_PER_THREAD);
+    if (chunk_lines < PARALLEL_MIN_CHUNK_LINES) {
+      chunk_lines = PARALLEL_MIN_CHUNK_LINES;
+    }
+  }
+
+  size_t count = 0;
+  Chunk *chunks = split_chunks(source, chunk_lines, &count);
+  if (!chunks) {
+    return -1;
+  }
+
+  ChunkJob job = {.source = source, .refs = refs, .chunks = chunks};
+  thread_pool_run(pool, count, parse_chunk, &job);
+
+  for (size_t i = 0; i < count; i++) {
+    if (chunks[i].failed) {
+      for (size_t j = 0; j < count; j++) {
+        free_chunk(&chunks[j]);
+      }
+      free(chunks);
+      return -1;
+    }
+  }
+
+  TRACE_BEGIN("stitch_chunks");
+  *head = stitch_chunks(refs, source->line_count, chunks, count);
+  TRACE_END("stitch_chunks");
+  free(chunks);
+  return 0;
+}
+
+// verify_parallel_blocks compares the top level blocks of a parallel parse
+// with a sequential one. Returns -1 when they are equal, otherwise the index
+// of the first block that differs.
+int verify_parallel_blocks(const MDBlock *parallel, const MDBlock *sequential) {
+  int index = 0;
+  for (; parallel != NULL && sequential != NULL;
+       parallel = parallel->next, sequential = sequential->next) {
+    if (!mdblock_equal(parallel, sequential)) {
+      return index;
+    }
+    index++;
+  }
+  return parallel == NULL && sequential == NULL ? -1 : index;
+}
+
+typedef struct {
+  MDSource *source;
+  int range_lines;
+  MDLinkReference **lists; // definitions of every range, last first
+} ReferenceJob;
+
+static void scan_reference_range(void *ctx, size_t index) {
+  ReferenceJob *job = ctx;
+  MDSource *source = job->source;
+  int start = (int)index * job->range_lines;
+  int end = start + job->range_lines;
+  if (end > source->line_count) {
+    end = source->line_count;
+  }
+
+  TRACE_BEGIN("scan_references");
+  STATS_BEGIN(PHASE_REFERENCES);
+  job->lists[index] = scan_link_references(
+      source->lines + start, end - start, source->reference_lines + start);
+  STATS_END();
+  if (trace_enabled) {
+    trace_end("scan_references", "\"first_line\": %d, \"lines\": %d", start,
+              end - start);
+  }
+}
+
+// collect_link_references is the reference pass over the whole source, in
+// ranges of lines on the pool when there is one. The definition lines are
+// kept in source so block parsing does not match them again. Returns the
+// same list as gen_markdown_link_reference_list.
+MDLinkReference *collect_link_references(ThreadPool *pool, MDSource *source) {
+  source->reference_lines = calloc(source->line_count + 1, sizeof(bool));
+  if (!source->reference_lines) {
+    perror("calloc failed");
+  }
+
+  int ranges = pool ? thread_pool_size(pool) * CHUNKS_PER_THREAD : 1;
+  if (ranges > source->line_count / PARALLEL_MIN_CHUNK_LINES) {
+    ranges = source->line_count / PARALLEL_MIN_CHUNK_LINES;
+  }
+  if (ranges <= 1 || !source->reference_lines) {
+    return scan_link_references(source->lines, source->line_count,
+                                source->reference_lines);
+  }
+
+  ReferenceJob job = {.source = source,
+                      .range_lines = (source->line_count + ranges - 1) / ranges,
+                      .lists = calloc(ranges, sizeof(MDLinkReference *))};
+  if (!job.lists) {
+    perror("calloc failed");
+    return scan_link_references(source->lines, source->line_count,
+                                source->reference_lines);
+  }
+  thread_pool_run(pool, ranges, scan_reference_range, &job);
+
+  // Later ranges go first, each list already has its last definition first
+  MDLinkReference *head = NULL;
+  MDLinkReference **tail = &head;
+  for (int i = ranges - 1; i >= 0; i--) {
+    *tail = job.lists[i];
+    while (*tail != NULL) {
+      tail = &(*tail)->next;
+    }
+  }
+  free(job.lists);
+  return head;
+}
+
+// Ranges per thread, small enough that threads finishing early can take over
+// the remaining ranges of a document with uneven blocks
+#define RANGES_PER_THREAD 16
+
+typedef struct {
+  MDLinkReference *refs;
+  MDBlock **blocks;
+  size_t block_count;
+  size_t range_blocks; // top level blocks per range
+  RenderedBody *body;
+  bool failed;
+} RenderJob;
+
+// render_range inline parses one range of top level blocks and renders it to
+// its own chunk
+static void render_range(void *ctx, size_t index) {
+  RenderJob *job = ctx;
+  size_t start = index * job->range_blocks;
+  size_t end = start + job->range_blocks;
+  if (end > job->block_count) {
+    end = job->block_count;
+  }
+
+  TRACE_BEGIN("render_range");
+  for (size_t i = start; i < end; i++) {
+    inline_parsing_tree(job->refs, job->blocks[i]);
+  }
+
+  STATS_BEGIN(PHASE_RENDER);
+  RenderChunk *chunk = &job->body->chunks[index];
+  FILE *fp = open_memstream(&chunk->data, &chunk->len);
+  if (!fp) {
+    perror("open_memstream failed");
+    __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+  } else {
+    for (size_t i = start; i < end; i++) {
+      print_html_block(fp, job->blocks[i]);
+    }
+    if (fclose(fp) != 0) {
+      perror("Failed to render block range");
+      __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+    }
+  }
+  STATS_END();
+
+  if (trace_enabled) {
+    trace_end("render_range", "\"first_block\": %zu, \"blocks\": %zu", start,
+              end - start);
+  }
+}
+
+// render_blocks_parallel inline parses and renders the top level blocks of
+// a tree built with defer_inline_parsing set, splitting them into ranges run
+// on the pool. Returns NULL on error.
+RenderedBody *render_blocks_parallel(ThreadPool *pool, MDLinkReference *refs,
+                                     MDBlock *head) {
+  RenderJob job = {.refs = refs};
+  for (MDBlock *block = head; block != NULL; block = block->next) {
+    job.block_count++;
+  }
+
+  job.body = calloc(1, sizeof(RenderedBody));
+  job.blocks = malloc((job.block_count + 1) * sizeof(MDBlock *));
+  if (!job.body || !job.blocks) {
+    perror("malloc failed");
+    free(job.body);
+    free(job.blocks);
+    return NULL;
+  }
+  size_t i = 0;
+  for (MDBlock *block = head; block != NULL; block = block->next) {
+    job.blocks[i++] = block;
+  }
+
+  size_t ranges = (size_t)thread_pool_size(pool) * RANGES_PER_THREAD;
+  job.range_blocks = (job.block_count + ranges - 1) / ranges;
+  if (job.range_blocks == 0) {
+    job.range_blocks = 1;
+  }
+  job.body->count = (job.block_count + job.range_blocks - 1) / job.range_blocks;
+  job.body->chunks = calloc(job.body->count + 1, sizeof(RenderChunk));
+  if (!job.body->chunks) {
+    perror("calloc failed");
+    free(job.blocks);
+    free(job.body);
+    return NULL;
+  }
+
+  thread_pool_run(pool, job.body->count, render_range, &job);
+  free(job.blocks);
+
+  if (job.failed) {
+    free_rendered_body(job.body);
+    return NULL;
+  }
+  return job.body;
+}
+
+int write_rendered_body(FILE *fp, const RenderedBody *body) {
+  for (size_t i = 0; i < body->count; i++) {
+    const RenderChunk *chunk = &body->chunks[i];
+    if (chunk->len > 0 && fwrite(chunk->data, 1, chunk->len, fp) != chunk->len) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+void free_rendered_body(RenderedBody *body) {
+  if (body == NULL) {
+    return;
+  }
+
+  for (size_t i = 0; i < body->count; i++) {
+    free(body->chunks[i].data);
+  }
+  free(body->chunks);
+  free(body);
+}
@@ -0,0 +1,41 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdio.h>
+
+#include "file_reader.h"
+#include "md_parser.h"
+#include "md_regex.h"
+#include "thread_pool.h"
+
+// Html of a run of consecutive top level blocks
+typedef struct {
+  char *data;
+  size_t len;
+} RenderChunk;
+
+// The document body as chunks in document order
+typedef struct {
+  RenderChunk *chunks;
+  size_t count;
+} RenderedBody;
+
+// Documents shorter than two chunks of this many lines are parsed
+// sequentially
+#ifndef PARALLEL_MIN_CHUNK_LINES
+#define PARALLEL_MIN_CHUNK_LINES 2048
+#endif
+
+MDLinkReference *collect_link_references(ThreadPool *pool, MDSource *source);
+
+int parse_blocks_parallel(ThreadPool *pool, MDSource *source,
+                          MDLinkReference *refs, int chunk_lines,
+                          MDBlock **head);
+int verify_parallel_blocks(const MDBlock *parallel, const MDBlock *sequential);
+
+RenderedBody *render_blocks_parallel(ThreadPool *pool, MDLinkReference *refs,
+                                     MDBlock *head);
+int write_rendered_body(FILE *fp, const RenderedBody *body);
+void free_rendered_body(RenderedBody *body);
+
+#endif
@@ -0,0 +1,484 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file_reader.h"
+#include "html_writer.h"
+#include "logger.h"
+#include "md_parser.h"
+#include "md_regex.h"
+#include "pipeline.h"
+#include "spsc_queue.h"
+#include "stats.h"
+#include "trace.h"
+
+#define SEGMENT_SIZE (64 * 1024)
+
+// Three stages connected by rings, each on its own thread:
+//   read:   reads the input, splits it into lines and collects the link
+//           references, lines go to the block stage
+//   block:  structures the lines into top level blocks with their children,
+//           every finished block goes to the render stage
+//   render: inline parses and writes every block, on the calling thread
+// A NULL item ends a ring. Inline parsing may use references defined further
+// down, so a block with a possible link waits until the read stage reached
+// the end of the input, and every block after it waits in order.
+//
+// Unless the blocks are kept, the render stage frees every written block and
+// publishes how many lines are no longer used. The read stage then reads into
+// the segments holding only such lines again instead of allocating new ones.
+typedef struct {
+  FILE *fp;
+  PipelineDocument *doc;
+  SpscQueue *lines;
+  SpscQueue *blocks;
+  SpscQueue *block_ends; // lines before the next block, for every block
+  bool keep_blocks;
+  int lines_popped; // by the block stage
+  int released_lines; // set atomically by the render stage
+  bool refs_ready; // doc->refs is complete, set atomically by the read stage
+  bool failed;     // set atomically by any stage
+} Pipeline;
+
+// Segments of SEGMENT_SIZE the read stage filled, oldest first
+typedef struct {
+  char **segments;
+  int *end_lines; // lines up to the end of each segment
+  size_t head;
+  size_t count;
+  size_t capacity;
+} SegmentRing;
+
+static void fail(Pipeline *pipeline) {
+  __atomic_store_n(&pipeline->failed, true, __ATOMIC_RELAXED);
+}
+
+static int add_segment(PipelineDocument *doc, char *segment, size_t size) {
+  char **segments =
+      realloc(doc->segments, (doc->segment_count + 1) * sizeof(char *));
+  if (!segments) {
+    perror("Unable to reallocate segments");
+    return -1;
+  }
+  doc->segments = segments;
+  doc->segments[doc->segment_count++] = segment;
+  doc->segment_bytes += size;
+  return 0;
+}
+
+static int keep_segment(SegmentRing *ring, char *segment, int end_line) {
+  if (ring->head > 0 && ring->count == ring->capacity) {
+    size_t used = ring->count - ring->head;
+    memmove(ring->segments, ring->segments + ring->head,
+            used * sizeof(char *));
+    memmove(ring->end_lines, ring->end_lines + ring->head, used * sizeof(int));
+    ring->head = 0;
+    ring->count = used;
+  }
+  if (ring->count == ring->capacity) {
+    size_t capacity = ring->capacity == 0 ? 16 : ring->capacity * 2;
+    char **segments = realloc(ring->segments, capacity * sizeof(char *));
+    if (!segments) {
+      perror("Unable to reallocate segments");
+      return -1;
+    }
+    ring->segments = segments;
+    int *end_lines = realloc(ring->end_lines, capacity * sizeof(int));
+    if (!end_lines) {
+      perror("Unable to reallocate segments");
+      return -1;
+    }
+    ring->end_lines = end_lines;
+    ring->capacity = capacity;
+  }
+  ring->segments[ring->count] = segment;
+  ring->end_lines[ring->count++] = end_line;
+  return 0;
+}
+
+// reuse_segment returns the oldest segment whose lines were all released by
+// the render stage, or NULL
+static char *reuse_segment(Pipeline *pipeline, SegmentRing *ring) {
+  if (ring->head == ring->count) {
+    return NULL;
+  }
+  int released = __atomic_load_n(&pipeline->released_lines, __ATOMIC_ACQUIRE);
+  if (ring->end_lines[ring->head] > released) {
+    return NULL;
+  }
+  return ring->segments[ring->head++];
+}
+
+static void emit_line(Pipeline *pipeline, char *line) {
+  PipelineDocument *doc = pipeline->doc;
+
+  // Same order as gen_markdown_link_reference_list, the last definition of a
+  // label comes first
+  STATS_BEGIN(PHASE_REFERENCES);
+  MDLinkReference *ref = parse_markdown_links_reference(line);
+  STATS_END();
+  if (ref != NULL) {
+    ref->next = doc->refs;
+    doc->refs = ref;
+  }
+
+  doc->line_count++;
+  spsc_queue_push(pipeline->lines, line);
+}
+
+// read_stage splits lines like new_md_source. Segments are never moved since
+// the queued lines point into them, a line cut at the end of a segment is
+// moved to the start of the next one, which may be the same segment reused.
+// Segments grown for a long line are not reused.
+static void *read_stage(void *arg) {
+  Pipeline *pipeline = arg;
+  PipelineDocument *doc = pipeline->doc;
+  STATS_BEGIN(PHASE_READ);
+  TRACE_BEGIN("read_stage");
+
+  SegmentRing ring = {0};
+  char *carry = NULL;
+  size_t carry_len = 0;
+  for (;;) {
+    size_t capacity = SEGMENT_SIZE;
+    while (capacity < carry_len * 2) {
+      capacity *= 2;
+    }
+    char *segment = NULL;
+    if (capacity == SEGMENT_SIZE) {
+      segment = reuse_segment(pipeline, &ring);
+    }
+    if (!segment) {
+      segment = malloc(capacity + 1);
+      if (!segment) {
+        perror("malloc failed");
+        fail(pipeline);
+        break;
+      }
+      if (add_segment(doc, segment, capacity + 1) != 0) {
+        free(segment);
+        fail(pipeline);
+        break;
+      }
+    }
+
+    if (carry_len > 0) {
+      memmove(segment, carry, carry_len);
+    }
+    size_t n = fread(segment + carry_len, 1, capacity - carry_len, pipeline->fp);
+    if (n == 0) {
+      if (ferror(pipeline->fp)) {
+        perror("fread failed");
+        fail(pipeline);
+      } else if (carry_len > 0) {
+        segment[carry_len] = '\0';
+        emit_line(pipeline, segment);
+      }
+      break;
+    }
+    doc->size += n;
+
+    char *end = segment + carry_len + n;
+    char *line = segment;
+    char *newline;
+    while ((newline = memchr(line, '\n', end - line)) != NULL) {
+      *newline = '\0';
+      emit_line(pipeline, line);
+      line = newline + 1;
+    }
+    carry = line;
+    carry_len = end - line;
+
+    if (capacity == SEGMENT_SIZE && !pipeline->keep_blocks &&
+        keep_segment(&ring, segment, doc->line_count) != 0) {
+      fail(pipeline);
+      break;
+    }
+  }
+  free(ring.segments);
+  free(ring.end_lines);
+
+  if (trace_enabled) {
+    trace_end("read_stage", "\"lines\": %d, \"bytes\": %zu", doc->line_count,
+              doc->size);
+  }
+  STATS_END();
+
+  // Published before the end of the lines, so the render stage sees it at
+  // the latest when the blocks end
+  __atomic_store_n(&pipeline->refs_ready, true, __ATOMIC_RELEASE);
+  spsc_queue_push(pipeline->lines, NULL);
+  return NULL;
+}
+
+static char *next_queued_line(void *ctx) {
+  Pipeline *pipeline = ctx;
+  char *line = spsc_queue_pop(pipeline->lines);
+  if (line != NULL) {
+    pipeline->lines_popped++;
+  }
+  return line;
+}
+
+// queue_block passes on the lines before the block following block along
+// with it, the render stage may release them once block is written
+static void queue_block(Pipeline *pipeline, MDBlock *block, int next_line) {
+  spsc_queue_push(pipeline->block_ends, (void *)(intptr_t)next_line);
+  spsc_queue_push(pipeline->blocks, block);
+}
+
+// block_stage is document_block_parsing with inline parsing deferred. A block
+// is finished once the next one starts, it is linked to its successor before
+// it is queued so the render stage never sees next change.
+static void *block_stage(void *arg) {
+  Pipeline *pipeline = arg;
+  STATS_BEGIN(PHASE_BLOCK);
+  TRACE_BEGIN("block_stage");
+
+  PeekReader *reader = new_peek_reader_from_callback(
+      next_queued_line, pipeline, DEFAULT_PEEK_COUNT);
+  if (!reader) {
+    fprintf(stderr, "Failed to create peek reader\n");
+    fail(pipeline);
+    // Keep the read stage from waiting on a full ring
+    while (spsc_queue_pop(pipeline->lines) != NULL) {
+    }
+  }
+
+  // The references are still being collected, they are only needed for
+  // inline parsing
+  MDBlock *head_block = NULL;
+  MDBlock *tail_block = NULL;
+  int block_count = 0;
+  while (reader != NULL && reader->count > 0) {
+    // The lines of this and later blocks start at the current line
+    int start_line = pipeline->lines_popped - reader->count;
+    MDBlock *new_block = block_parsing(NULL, tail_block, reader, NULL);
+    if (new_block == NULL) {
+      continue;
+    }
+
+    LOGF("block: %d, content: %s\n", new_block->block, new_block->content);
+    if (tail_block == NULL) {
+      head_block = new_block;
+    } else {
+      child_parsing_exec(NULL, tail_block);
+      tail_block->next = new_block;
+      queue_block(pipeline, tail_block, start_line);
+    }
+    tail_block = new_block;
+    block_count++;
+  }
+  if (tail_block != NULL) {
+    child_parsing_exec(NULL, tail_block);
+    queue_block(pipeline, tail_block, pipeline->lines_popped);
+  }
+  if (pipeline->keep_blocks) {
+    pipeline->doc->head = head_block;
+  }
+  free_peek_reader(reader);
+
+  if (trace_enabled) {
+    trace_end("block_stage", "\"blocks\": %d", block_count);
+  }
+  STATS_END();
+
+  spsc_queue_push(pipeline->blocks, NULL);
+  return NULL;
+}
+
+static void render_block(MDLinkReference *refs, MDBlock *block,
+                         const PipelineOutput *outputs, int output_count,
+                         const HtmlOptions *opts, bool first) {
+  inline_parsing_tree(refs, block);
+
+  STATS_BEGIN(PHASE_RENDER);
+  for (int i = 0; i < output_count; i++) {
+    if (first && !outputs[i].fragment) {
+      write_html_head(outputs[i].fp, opts, NULL);
+    }
+    print_html_block(outputs[i].fp, block);
+  }
+  STATS_END();
+}
+
+// may_use_references reports whether inline parsing block could resolve a
+// link reference. Every reference link has a closing bracket.
+static bool may_use_references(const MDBlock *block) {
+  if (block->block != CODEBLOCK && block->block != SECTION_BREAK &&
+      block->block != HTML_TAG && block->content != NULL &&
+      strchr(block->content, ']') != NULL) {
+    return true;
+  }
+  for (const MDBlock *child = block->child; child != NULL;
+       child = child->next) {
+    if (may_use_references(child)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// release_block frees a written block unless the document is kept, it is
+// counted here since it is gone by the time the pipeline returns
+static void release_block(Pipeline *pipeline, MDBlock *block) {
+  if (pipeline->keep_blocks) {
+    return;
+  }
+  block->next = NULL;
+  if (stats_enabled) {
+    stats_count_blocks(block);
+  }
+  free_mdblocks(block);
+}
+
+static void release_lines(Pipeline *pipeline, int line_count) {
+  if (!pipeline->keep_blocks) {
+    __atomic_store_n(&pipeline->released_lines, line_count, __ATOMIC_RELEASE);
+  }
+}
+
+// render_stage writes the page boilerplate around the first and last block
+// only, so an empty document writes nothing like generate_html.
+static void render_stage(Pipeline *pipeline, const PipelineOutput *outputs,
+                         int output_count, const HtmlOptions *opts) {
+  TRACE_BEGIN("render_stage");
+
+  // Blocks waiting for the references are consecutive, each already linked
+  // to the next one
+  MDBlock *waiting = NULL;
+  int waiting_count = 0;
+  int waiting_end = 0;
+  bool refs_ready = false;
+  int block_count = 0;
+  for (;;) {
+    MDBlock *block = spsc_queue_pop(pipeline->blocks);
+    int block_end = 0;
+    if (block != NULL) {
+      block_end = (int)(intptr_t)spsc_queue_pop(pipeline->block_ends);
+    }
+    if (!refs_ready &&
+        __atomic_load_n(&pipeline->refs_ready, __ATOMIC_ACQUIRE)) {
+      refs_ready = true;
+      if (waiting_count > 0) {
+        for (; waiting_count > 0; waiting_count--) {
+          MDBlock *next = waiting->next;
+          render_block(pipeline->doc->refs, waiting, outputs, output_count,
+                       opts, block_count++ == 0);
+          release_block(pipeline, waiting);
+          waiting = next;
+        }
+        release_lines(pipeline, waiting_end);
+      }
+    }
+    if (block == NULL) {
+      break;
+    }
+
+    // Until the references are complete, only a block that cannot use them
+    // is written ahead, and only while none is waiting before it
+    if (refs_ready || (waiting_count == 0 && !may_use_references(block))) {
+      render_block(refs_ready ? pipeline->doc->refs : NULL, block, outputs,
+                   output_count, opts, block_count++ == 0);
+      release_block(pipeline, block);
+      release_lines(pipeline, block_end);
+    } else {
+      if (waiting_count++ == 0) {
+        waiting = block;
+      }
+      waiting_end = block_end;
+    }
+  }
+
+  if (block_count > 0) {
+    for (int i = 0; i < output_count; i++) {
+      if (!outputs[i].fragment) {
+        write_html_tail(outputs[i].fp, opts);
+      }
+    }
+  }
+
+  if (trace_enabled) {
+    trace_end("render_stage", "\"blocks\": %d", block_count);
+  }
+}
+
+// run_pipeline converts md_file into every output with the read and block
+// stages on their own threads. Returns NULL on error.
+PipelineDocument *run_pipeline(FILE *md_file, const PipelineOutput *outputs,
+                               int output_count, const HtmlOptions *opts,
+                               bool keep_blocks) {
+  PipelineDocument *doc = calloc(1, sizeof(PipelineDocument));
+  if (!doc) {
+    perror("calloc failed");
+    return NULL;
+  }
+
+  Pipeline pipeline = {.fp = md_file,
+                       .doc = doc,
+                       .lines = new_spsc_queue(PIPELINE_LINE_QUEUE),
+                       .blocks = new_spsc_queue(PIPELINE_BLOCK_QUEUE),
+                       .block_ends = new_spsc_queue(PIPELINE_BLOCK_QUEUE),
+                       .keep_blocks = keep_blocks,
+                       .lines_popped = 0,
+                       .released_lines = 0,
+                       .refs_ready = false,
+                       .failed = false};
+  if (!pipeline.lines || !pipeline.blocks || !pipeline.block_ends) {
+    free_spsc_queue(pipeline.lines);
+    free_spsc_queue(pipeline.blocks);
+    free_spsc_queue(pipeline.block_ends);
+    free(doc);
+    return NULL;
+  }
+
+  defer_inline_parsing = true;
+
+  pthread_t reader_thread;
+  pthread_t block_thread;
+  int err = pthread_create(&reader_thread, NULL, read_stage, &pipeline);
+  if (err != 0) {
+    fprintf(stderr, "pthread_create failed: %d\n", err);
+    free_spsc_queue(pipeline.lines);
+    free_spsc_queue(pipeline.blocks);
+    free_spsc_queue(pipeline.block_ends);
+    free(doc);
+    return NULL;
+  }
+  err = pthread_create(&block_thread, NULL, block_stage, &pipeline);
+  if (err != 0) {
+    fprintf(stderr, "pthread_create failed: %d\n", err);
+    fail(&pipeline);
+    while (spsc_queue_pop(pipeline.lines) != NULL) {
+    }
+  } else {
+    render_stage(&pipeline, outputs, output_count, opts);
+    pthread_join(block_thread, NULL);
+  }
+  pthread_join(reader_thread, NULL);
+
+  free_spsc_queue(pipeline.lines);
+  free_spsc_queue(pipeline.blocks);
+  free_spsc_queue(pipeline.block_ends);
+  if (pipeline.failed) {
+    free_pipeline_document(doc);
+    return NULL;
+  }
+  return doc;
+}
+
+void free_pipeline_document(PipelineDocument *doc) {
+  if (doc == NULL) {
+    return;
+  }
+
+  free_mdblocks(doc->head);
+  free_md_link_reference(doc->refs);
+  for (size_t i = 0; i < doc->segment_count; i++) {
+    free(doc->segments[i]);
+  }
+  free(doc->segments);
+  free(doc);
+}
@@ -0,0 +1,41 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "html_writer.h"
+#include "md_parser.h"
+#include "md_regex.h"
+
+// Ring sizes between the stages, in lines and in top level blocks
+#ifndef PIPELINE_LINE_QUEUE
+#define PIPELINE_LINE_QUEUE 4096
+#endif
+#ifndef PIPELINE_BLOCK_QUEUE
+#define PIPELINE_BLOCK_QUEUE 256
+#endif
+
+typedef struct {
+  FILE *fp;
+  bool fragment; // bare html fragment without page boilerplate
+} PipelineOutput;
+
+// Document converted by run_pipeline. The lines of the blocks point into
+// segments, so the blocks must be freed first.
+typedef struct {
+  MDBlock *head; // NULL unless the blocks were kept
+  MDLinkReference *refs;
+  char **segments; // input read in fixed size pieces
+  size_t segment_count;
+  size_t segment_bytes; // allocated for segments
+  int line_count;
+  size_t size; // input bytes
+} PipelineDocument;
+
+PipelineDocument *run_pipeline(FILE *md_file, const PipelineOutput *outputs,
+                               int output_count, const HtmlOptions *opts,
+                               bool keep_blocks);
+void free_pipeline_document(PipelineDocument *doc);
+
+#endif
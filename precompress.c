@@ -0,0 +1,388 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "precompress.h"
+#include "str_utils.h"
+
+#define PRECOMPRESS_CHUNK 16384
+// Copies are made on every page of the conversion pass, so they use the
+// default levels rather than the slowest, smallest ones
+#define PRECOMPRESS_ZSTD_LEVEL 3
+// zlib counts input in unsigned int, larger writes are fed in pieces
+#define PRECOMPRESS_MAX_INPUT (1u << 30)
+
+// A compressed copy being written to PATH.EXT.tmp, renamed to PATH.EXT once
+// complete so servers never pick up a partial file
+typedef struct {
+  const char *ext;
+  char *path;
+  FILE *fp;
+} Sidecar;
+
+struct Precompressor {
+  const char *path;
+  bool failed;
+  bool etag;
+  uint64_t hash; // FNV-1a of the uncompressed output
+  Sidecar gzip;
+  z_stream deflate;
+  bool deflate_ready;
+#ifdef HAVE_ZSTD
+  Sidecar zstd;
+  ZSTD_CCtx *cctx;
+#endif
+  unsigned char out[PRECOMPRESS_CHUNK];
+};
+
+// parse_precompress_formats reads a comma separated list of gzip and zstd
+// into formats. Returns 0 on success, -1 on an unknown or unavailable format.
+int parse_precompress_formats(const char *list, unsigned int *formats) {
+  *formats = 0;
+  const char *p = list;
+  do {
+    size_t len = strcspn(p, ",");
+    if (len == 4 && strncmp(p, "gzip", 4) == 0) {
+      *formats |= PRECOMPRESS_GZIP;
+    } else if (len == 4 && strncmp(p, "zstd", 4) == 0) {
+#ifdef HAVE_ZSTD
+      *formats |= PRECOMPRESS_ZSTD;
+#else
+      fprintf(stderr, "zstd support is not built in, rebuild with "
+                      "make ZSTD=1\n");
+      return -1;
+#endif
+    } else {
+      fprintf(stderr, "Unknown --precompress format: %.*s\n", (int)len, p);
+      return -1;
+    }
+    p += len;
+  } while (*p++ == ',');
+  return 0;
+}
+
+static char *sidecar_path(const char *path, const char *ext, bool tmp) {
+  size_t len = strlen(path) + strlen(ext) + strlen(".tmp") + 1;
+  char *sidecar = malloc(len);
+  if (!sidecar) {
+    perror("malloc failed");
+    return NULL;
+  }
+  snprintf(sidecar, len, "%s%s%s", path, ext, tmp ? ".tmp" : "");
+  return sidecar;
+}
+
+static int open_sidecar(Sidecar *sc, const char *path, const char *ext) {
+  sc->ext = ext;
+  sc->path = sidecar_path(path, ext, true);
+  if (!sc->path) {
+    return -1;
+  }
+  sc->fp = fopen(sc->path, "wb");
+  if (!sc->fp) {
+    fprintf(stderr, "Failed to open output file: %s\n", sc->path);
+    free(sc->path);
+    sc->path = NULL;
+    return -1;
+  }
+  return 0;
+}
+
+// close_sidecar moves a complete file in place, or removes an incomplete one
+static int close_sidecar(Sidecar *sc, const char *path, bool complete) {
+  if (sc->path == NULL) {
+    return 0;
+  }
+
+  int status = fclose(sc->fp) == 0 && complete ? 0 : -1;
+  char *final_path = status == 0 ? sidecar_path(path, sc->ext, false) : NULL;
+  if (status == 0 && (!final_path || rename(sc->path, final_path) != 0)) {
+    status = -1;
+  }
+  if (status != 0) {
+    if (complete) {
+      fprintf(stderr, "Failed to write output file %s%s: %s\n", path, sc->ext,
+              strerror(errno));
+    }
+    unlink(sc->path);
+  }
+  free(final_path);
+  free(sc->path);
+  sc->path = NULL;
+  return status;
+}
+
+static int write_chunk(Precompressor *pc, Sidecar *sc, size_t len) {
+  if (len > 0 && fwrite(pc->out, 1, len, sc->fp) != len) {
+    fprintf(stderr, "Failed to write output file %s%s: %s\n", pc->path,
+            sc->ext, strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+// deflate_input compresses the pending input of the gzip stream, flushing it
+// to the end of the stream with Z_FINISH
+static int deflate_input(Precompressor *pc, int flush) {
+  z_stream *z = &pc->deflate;
+  int ret;
+  do {
+    z->next_out = pc->out;
+    z->avail_out = PRECOMPRESS_CHUNK;
+    ret = deflate(z, flush);
+    if (ret == Z_STREAM_ERROR) {
+      fprintf(stderr, "gzip compression failed\n");
+      return -1;
+    }
+    if (write_chunk(pc, &pc->gzip, PRECOMPRESS_CHUNK - z->avail_out) != 0) {
+      return -1;
+    }
+  } while (flush == Z_FINISH ? ret != Z_STREAM_END : z->avail_out == 0);
+  return 0;
+}
+
+#ifdef HAVE_ZSTD
+static int zstd_input(Precompressor *pc, const void *data, size_t len,
+                      ZSTD_EndDirective mode) {
+  ZSTD_inBuffer in = {data, len, 0};
+  size_t remaining;
+  do {
+    ZSTD_outBuffer out = {pc->out, PRECOMPRESS_CHUNK, 0};
+    remaining = ZSTD_compressStream2(pc->cctx, &out, &in, mode);
+    if (ZSTD_isError(remaining)) {
+      fprintf(stderr, "zstd compression failed: %s\n",
+              ZSTD_getErrorName(remaining));
+      return -1;
+    }
+    if (write_chunk(pc, &pc->zstd, out.pos) != 0) {
+      return -1;
+    }
+  } while (mode == ZSTD_e_end ? remaining != 0 : in.pos < in.size);
+  return 0;
+}
+#endif
+
+// free_precompressor closes the copies, keeping them only if complete.
+// Returns -1 if a complete copy could not be kept.
+static int free_precompressor(Precompressor *pc, bool complete) {
+  int status = 0;
+  if (pc->deflate_ready) {
+    deflateEnd(&pc->deflate);
+  }
+  if (close_sidecar(&pc->gzip, pc->path, complete) != 0) {
+    status = -1;
+  }
+#ifdef HAVE_ZSTD
+  ZSTD_freeCCtx(pc->cctx);
+  if (close_sidecar(&pc->zstd, pc->path, complete) != 0) {
+    status = -1;
+  }
+#endif
+  free(pc);
+  return status;
+}
+
+// new_precompressor starts the compressed copies of the output file at path,
+// and its ETag when etag is set. Returns NULL on error.
+Precompressor *new_precompressor(const char *path, unsigned int formats,
+                                 bool etag) {
+  Precompressor *pc = calloc(1, sizeof(Precompressor));
+  if (!pc) {
+    perror("calloc failed");
+    return NULL;
+  }
+  pc->path = path;
+  pc->etag = etag;
+  pc->hash = FNV1A64_SEED;
+
+  if (formats & PRECOMPRESS_GZIP) {
+    if (open_sidecar(&pc->gzip, path, ".gz") != 0) {
+      free_precompressor(pc, false);
+      return NULL;
+    }
+    // 16 over the window bits asks for a gzip header
+    if (deflateInit2(&pc->deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16,
+                     8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      fprintf(stderr, "Failed to start gzip compression\n");
+      free_precompressor(pc, false);
+      return NULL;
+    }
+    pc->deflate_ready = true;
+  }
+#ifdef HAVE_ZSTD
+  if (formats & PRECOMPRESS_ZSTD) {
+    if (open_sidecar(&pc->zstd, path, ".zst") != 0) {
+      free_precompressor(pc, false);
+      return NULL;
+    }
+    pc->cctx = ZSTD_createCCtx();
+    if (!pc->cctx ||
+        ZSTD_isError(ZSTD_CCtx_setParameter(pc->cctx, ZSTD_c_compressionLevel,
+                                            PRECOMPRESS_ZSTD_LEVEL))) {
+      fprintf(stderr, "Failed to start zstd compression\n");
+      free_precompressor(pc, false);
+      return NULL;
+    }
+  }
+#endif
+  return pc;
+}
+
+// precompress_write adds data written to the output file. After an error
+// the copies are dropped and -1 is returned.
+int precompress_write(Precompressor *pc, const void *data, size_t len) {
+  if (pc->failed) {
+    return -1;
+  }
+
+  const unsigned char *p = data;
+  pc->hash = fnv1a64(data, len, pc->hash);
+  while (len > 0) {
+    size_t piece = len < PRECOMPRESS_MAX_INPUT ? len : PRECOMPRESS_MAX_INPUT;
+    if (pc->deflate_ready) {
+      pc->deflate.next_in = (unsigned char *)p;
+      pc->deflate.avail_in = (unsigned int)piece;
+      if (deflate_input(pc, Z_NO_FLUSH) != 0) {
+        pc->failed = true;
+        return -1;
+      }
+    }
+#ifdef HAVE_ZSTD
+    if (pc->cctx && zstd_input(pc, p, piece, ZSTD_e_continue) != 0) {
+      pc->failed = true;
+      return -1;
+    }
+#endif
+    p += piece;
+    len -= piece;
+  }
+  return 0;
+}
+
+static int write_etag(const Precompressor *pc) {
+  char *path = sidecar_path(pc->path, ".etag", false);
+  if (!path) {
+    return -1;
+  }
+  FILE *fp = fopen(path, "w");
+  if (!fp) {
+    fprintf(stderr, "Failed to open output file: %s\n", path);
+    free(path);
+    return -1;
+  }
+  fprintf(fp, "\"%016" PRIx64 "\"\n", pc->hash);
+  int status = 0;
+  if (fclose(fp) != 0) {
+    fprintf(stderr, "Failed to write output file %s: %s\n", path,
+            strerror(errno));
+    status = -1;
+  }
+  free(path);
+  return status;
+}
+
+// finish_precompressor ends the compressed copies, moves them in place next
+// to the output file and writes its ETag, then frees pc. Returns 0 on
+// success, -1 on error.
+int finish_precompressor(Precompressor *pc) {
+  if (!pc->failed && pc->deflate_ready && deflate_input(pc, Z_FINISH) != 0) {
+    pc->failed = true;
+  }
+#ifdef HAVE_ZSTD
+  if (!pc->failed && pc->cctx &&
+      zstd_input(pc, NULL, 0, ZSTD_e_end) != 0) {
+    pc->failed = true;
+  }
+#endif
+  if (!pc->failed && pc->etag && write_etag(pc) != 0) {
+    pc->failed = true;
+  }
+
+  bool complete = !pc->failed;
+  if (free_precompressor(pc, complete) != 0 || !complete) {
+    return -1;
+  }
+  return 0;
+}
+
+typedef struct {
+  FILE *fp;
+  Precompressor *pc;
+} PrecompressCookie;
+
+static ssize_t precompress_cookie_write(void *cookie, const char *buf,
+                                        size_t size) {
+  PrecompressCookie *c = cookie;
+  size_t written = fwrite(buf, 1, size, c->fp);
+  if (written > 0) {
+    precompress_write(c->pc, buf, written);
+  }
+  return written == 0 && size > 0 ? -1 : (ssize_t)written;
+}
+
+static int precompress_cookie_close(void *cookie) {
+  PrecompressCookie *c = cookie;
+  int status = finish_precompressor(c->pc) == 0 ? 0 : EOF;
+  if (c->fp == stdout) {
+    if (fflush(c->fp) != 0) {
+      status = EOF;
+    }
+  } else if (fclose(c->fp) != 0) {
+    status = EOF;
+  }
+  free(c);
+  return status;
+}
+
+// precompress_output wraps fp, the output file at path, in a stream that
+// compresses what is written to it in the same pass. Closing the returned
+// stream completes the copies and closes fp, except stdout which is flushed.
+// Returns NULL on error, fp is then left open.
+FILE *precompress_output(FILE *fp, const char *path, unsigned int formats,
+                         bool etag) {
+  PrecompressCookie *c = malloc(sizeof(PrecompressCookie));
+  if (!c) {
+    perror("malloc failed");
+    return NULL;
+  }
+  c->fp = fp;
+  c->pc = new_precompressor(path, formats, etag);
+  if (!c->pc) {
+    free(c);
+    return NULL;
+  }
+
+  cookie_io_functions_t io = {.read = NULL,
+                              .write = precompress_cookie_write,
+                              .seek = NULL,
+                              .close = precompress_cookie_close};
+  FILE *stream = fopencookie(c, "w", io);
+  if (!stream) {
+    perror("fopencookie failed");
+    free_precompressor(c->pc, false);
+    free(c);
+    return NULL;
+  }
+  return stream;
+}
+
+// precompress_buffer writes the compressed copies of an output file already
+// rendered to memory. Returns 0 on success, -1 on error.
+int precompress_buffer(const char *path, const void *data, size_t len,
+                       unsigned int formats, bool etag) {
+  Precompressor *pc = new_precompressor(path, formats, etag);
+  if (!pc) {
+    return -1;
+  }
+  precompress_write(pc, data, len);
+  return finish_precompressor(pc);
+}
@@ -0,0 +1,25 @@
+#ifndef PRECOMPRESS_H
+#define PRECOMPRESS_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Compressed copies written next to an output file, as a bit set
+#define PRECOMPRESS_GZIP 1u // PATH.gz
+#define PRECOMPRESS_ZSTD 2u // PATH.zst, only when built with ZSTD=1
+
+typedef struct Precompressor Precompressor;
+
+int parse_precompress_formats(const char *list, unsigned int *formats);
+
+Precompressor *new_precompressor(const char *path, unsigned int formats,
+                                 bool etag);
+int precompress_write(Precompressor *pc, const void *data, size_t len);
+int finish_precompressor(Precompressor *pc);
+
+FILE *precompress_output(FILE *fp, const char *path, unsigned int formats,
+                         bool etag);
+int precompress_buffer(const char *path, const void *data, size_t len,
+                       unsigned int formats, bool etag);
+
+#endif
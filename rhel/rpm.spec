@@ -12,6 +12,7 @@ BuildRequires:  make
 BuildRequires:  pkgconfig
 BuildRequires:  libunistring-devel
 BuildRequires:  pcre2-devel
+BuildRequires:  zlib-devel
 
 %description
 mthc is a converter that generate HTML from Markdown. This package contains the mthc CLI.
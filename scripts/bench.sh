@@ -0,0 +1,385 @@
+#!/usr/bin/env bash
+
+# Generated corpus and results are kept here between runs
+_BENCH_DIR="${BENCH_DIR:-_bench}"
+
+_PROFILES=(prose lists code links refs emphasis html)
+_ALL_SIZES=(1K 10K 100K 1M 10M 100M 1G)
+
+# Largest document size to generate, the full ladder goes up to 1G
+_MAX_SIZE="${BENCH_MAX_SIZE:-1M}"
+# Runs per document, the fastest one is reported
+_REPEAT="${BENCH_REPEAT:-3}"
+# Seconds before a single run is given up and reported as failed
+_TIMEOUT="${BENCH_TIMEOUT:-300}"
+# Allowed growth of time per byte between two consecutive sizes
+_LINEARITY_TOLERANCE="${BENCH_LINEARITY_TOLERANCE:-2.0}"
+# Runs shorter than this are dominated by process start up and are not
+# used for the linearity check
+_MIN_CHECK_TIME="${BENCH_MIN_CHECK_TIME:-0.02}"
+
+# Result will be in the format of "profile|size|bytes|seconds|peak_rss_kb"
+_BENCH_RESULTS=()
+
+# output color settings
+_RED=$(tput setaf 1)
+_GREEN=$(tput setaf 2)
+_YELLOW=$(tput setaf 3)
+_CYAN=$(tput setaf 6)
+_RESET=$(tput sgr0)
+
+# --------------------------------------------------------------------------------------------------
+# Convert a size like 10K, 1M or 1G into bytes
+#
+# Arguments:
+#   $1: size
+# --------------------------------------------------------------------------------------------------
+size_to_bytes() {
+    local _size="${1}"
+    case "${_size}" in
+    *K) echo $((${_size%K} * 1024)) ;;
+    *M) echo $((${_size%M} * 1024 * 1024)) ;;
+    *G) echo $((${_size%G} * 1024 * 1024 * 1024)) ;;
+    *) echo "${_size}" ;;
+    esac
+}
+
+# --------------------------------------------------------------------------------------------------
+# Generate a markdown document of the given profile, stops once the document
+# reaches the requested number of bytes. Output is deterministic for a profile
+# and size.
+#
+# Arguments:
+#   $1: profile
+#   $2: bytes
+#   $3: output_file
+# --------------------------------------------------------------------------------------------------
+gen_corpus() {
+    if [[ ${#} -ne 3 ]]; then
+        echo "Usage: ${FUNCNAME[0]} <profile> <bytes> <output_file>"
+        return 1
+    fi
+
+    awk -v profile="${1}" -v limit="${2}" '
+    function word() { return words[int(rand() * nwords) + 1] }
+    function sentence(n,    s, i) {
+        s = word()
+        for (i = 1; i < n; i++) s = s " " word()
+        return s
+    }
+    function emit(s) { print s; bytes += length(s) + 1 }
+
+    function prose(    i) {
+        emit("## " sentence(4))
+        emit("")
+        for (i = 0; i < 3; i++) {
+            emit(sentence(12) ".")
+            emit(sentence(10) ", " sentence(6) ".")
+            emit("")
+        }
+    }
+    function lists(    i) {
+        emit("- " sentence(5))
+        for (i = 0; i < 3; i++) {
+            emit("    - " sentence(4))
+            emit("        - " sentence(3) " *" word() "*")
+            emit("        - " sentence(3))
+        }
+        emit("- " sentence(5))
+        emit("")
+        emit("1. " sentence(4))
+        emit("2. " sentence(4))
+        emit("    1. " sentence(3))
+        emit("")
+    }
+    function code(    i) {
+        emit(sentence(6) ":")
+        emit("")
+        for (i = 0; i < 200 && bytes < limit; i++) {
+            emit("    if (" word() " < " i ") { " word() "(&" word() "); }")
+        }
+        emit("")
+    }
+    function links(    i, s) {
+        s = ""
+        for (i = 0; i < 8; i++) {
+            s = s word() " [" sentence(2) "](https://example.com/" word() " \"" word() "\") "
+        }
+        emit(s "<https://example.org/" word() ">")
+        emit("")
+    }
+    function refs(    i, s) {
+        s = ""
+        for (i = 0; i < 6; i++) {
+            s = s word() " [" word() "][r" (nref + i) "] "
+        }
+        emit(s)
+        emit("")
+        for (i = 0; i < 6; i++) {
+            emit("[r" nref "]: https://example.com/" word() " \"" word() "\"")
+            nref++
+        }
+        emit("")
+    }
+    function emphasis(    i, s) {
+        s = ""
+        for (i = 0; i < 10; i++) {
+            s = s "*" word() "* **" word() "** `" word() "` _" word() "_ "
+        }
+        emit(s)
+        emit("")
+    }
+    function html(    i) {
+        emit("<table>")
+        for (i = 0; i < 20 && bytes < limit; i++) {
+            emit("<tr><td>" word() "</td><td>" word() " &amp; " word() "</td></tr>")
+        }
+        emit("</table>")
+        emit("")
+    }
+
+    BEGIN {
+        srand(42)
+        nwords = split("lorem ipsum dolor sit amet consectetur adipiscing elit sed do " \
+                       "eiusmod tempor incididunt ut labore et dolore magna aliqua enim " \
+                       "minim veniam quis nostrud exercitation ullamco laboris nisi", words, " ")
+        bytes = 0
+        nref = 0
+        while (bytes < limit) {
+            if (profile == "prose") prose()
+            else if (profile == "lists") lists()
+            else if (profile == "code") code()
+            else if (profile == "links") links()
+            else if (profile == "refs") refs()
+            else if (profile == "emphasis") emphasis()
+            else if (profile == "html") html()
+            else { print "unknown profile: " profile > "/dev/stderr"; exit 1 }
+        }
+    }' >"${3}"
+}
+
+# --------------------------------------------------------------------------------------------------
+# Run mthc once on the input through bench_run, prints "seconds peak_rss_kb"
+#
+# Globals:
+#   _BENCH_DIR
+#   _TIMEOUT
+#
+# Arguments:
+#   $1: input_file
+# --------------------------------------------------------------------------------------------------
+run_once() {
+    local _input_file="${1}"
+    local _result_file="${_BENCH_DIR}/run.out"
+
+    if ! timeout "${_TIMEOUT}" "${_BENCH_DIR}/bench_run" "${_result_file}" \
+        ./mthc --test "${_input_file}" >/dev/null 2>&1; then
+        echo "failed n/a"
+        return 1
+    fi
+    cat "${_result_file}"
+}
+
+# --------------------------------------------------------------------------------------------------
+# Benchmark one generated document, result will be append to _BENCH_RESULTS
+#
+# Globals:
+#   _BENCH_DIR
+#   _BENCH_RESULTS
+#   _REPEAT
+#
+# Arguments:
+#   $1: profile
+#   $2: size
+# --------------------------------------------------------------------------------------------------
+run_bench() {
+    local _profile="${1}"
+    local _size="${2}"
+    local _bytes
+    _bytes="$(size_to_bytes "${_size}")"
+    local _input_file="${_BENCH_DIR}/${_profile}-${_size}.md"
+
+    if [[ ! -f "${_input_file}" ]]; then
+        echo "Generate ${_input_file}..."
+        gen_corpus "${_profile}" "${_bytes}" "${_input_file}" || return 1
+    fi
+    _bytes="$(wc -c <"${_input_file}")"
+
+    local _best=""
+    local _best_rss="n/a"
+    local _i
+    for ((_i = 0; _i < _REPEAT; _i++)); do
+        local _seconds _rss
+        read -r _seconds _rss <<<"$(run_once "${_input_file}")"
+        if [[ "${_seconds}" == "failed" ]]; then
+            _best="failed"
+            break
+        fi
+        if [[ -z "${_best}" ]] || awk -v a="${_seconds}" -v b="${_best}" 'BEGIN { exit !(a < b) }'; then
+            _best="${_seconds}"
+            _best_rss="${_rss}"
+        fi
+    done
+
+    _BENCH_RESULTS+=("${_profile}|${_size}|${_bytes}|${_best}|${_best_rss}")
+}
+
+# --------------------------------------------------------------------------------------------------
+# Show throughput of every run and check that time grows linearly with size
+#
+# Globals:
+#   _BENCH_RESULTS
+#   _LINEARITY_TOLERANCE
+#   _MIN_CHECK_TIME
+#
+# Output:
+#   The result table, also written to results.tsv in _BENCH_DIR
+# --------------------------------------------------------------------------------------------------
+print_result() {
+    local _tsv="${_BENCH_DIR}/results.tsv"
+    local _failed_count=0
+    local _prev_profile=""
+    local _prev_bytes=0
+    local _prev_seconds=""
+
+    echo "===== Result ====="
+    printf "%-10s %6s %12s %10s %10s %10s %10s  %s\n" \
+        "profile" "size" "bytes" "seconds" "MB/s" "docs/s" "rss(KB)" "linearity"
+    printf "profile\tsize\tbytes\tseconds\tmb_per_s\tdocs_per_s\tpeak_rss_kb\n" >"${_tsv}"
+
+    local _result
+    for _result in "${_BENCH_RESULTS[@]}"; do
+        local _profile _size _bytes _seconds _rss
+        IFS='|' read -r _profile _size _bytes _seconds _rss <<<"${_result}"
+
+        if [[ "${_profile}" != "${_prev_profile}" ]]; then
+            _prev_seconds=""
+        fi
+
+        if [[ "${_seconds}" == "failed" ]]; then
+            printf "%s%-10s %6s %12s %10s%s\n" "${_YELLOW}" "${_profile}" "${_size}" \
+                "${_bytes}" "failed" "${_RESET}"
+            printf "%s\t%s\t%s\tfailed\t\t\t\n" "${_profile}" "${_size}" "${_bytes}" >>"${_tsv}"
+            _prev_profile="${_profile}"
+            _prev_seconds=""
+            continue
+        fi
+
+        local _mbps _docs
+        read -r _mbps _docs <<<"$(awk -v b="${_bytes}" -v s="${_seconds}" \
+            'BEGIN { if (s <= 0) s = 0.000001; printf "%.2f %.1f\n", b / s / 1048576, 1 / s }')"
+
+        local _linearity="-"
+        if [[ -n "${_prev_seconds}" ]]; then
+            _linearity="$(awk -v pb="${_prev_bytes}" -v ps="${_prev_seconds}" \
+                -v b="${_bytes}" -v s="${_seconds}" -v tol="${_LINEARITY_TOLERANCE}" \
+                -v min="${_MIN_CHECK_TIME}" 'BEGIN {
+                    if (ps < min || s < min) { print "-"; exit }
+                    growth = (s / ps) / (b / pb)
+                    printf "%s x%.2f\n", (growth > tol ? "FAILED" : "ok"), growth
+                }')"
+        fi
+
+        local _color="${_GREEN}"
+        if [[ "${_linearity}" == FAILED* ]]; then
+            _color="${_RED}"
+            ((_failed_count++))
+        fi
+        printf "%-10s %6s %12s %10s %10s %10s %10s  %s%s%s\n" "${_profile}" "${_size}" \
+            "${_bytes}" "${_seconds}" "${_mbps}" "${_docs}" "${_rss}" \
+            "${_color}" "${_linearity}" "${_RESET}"
+        printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\n" "${_profile}" "${_size}" "${_bytes}" \
+            "${_seconds}" "${_mbps}" "${_docs}" "${_rss}" >>"${_tsv}"
+
+        _prev_profile="${_profile}"
+        _prev_bytes="${_bytes}"
+        _prev_seconds="${_seconds}"
+    done
+
+    echo ""
+    echo "Results written to ${_tsv}"
+    plot_result "${_tsv}"
+
+    local _format="${_CYAN}"
+    if [[ ${_failed_count} -ne 0 ]]; then
+        _format="${_YELLOW}"
+    fi
+    echo "${_format}Linearity check failed: ${_failed_count}${_RESET}"
+
+    if [[ ${_failed_count} -ne 0 ]]; then
+        return 1
+    fi
+}
+
+# --------------------------------------------------------------------------------------------------
+# Plot time against input size on log-log axes when gnuplot is available
+#
+# Arguments:
+#   $1: results_tsv
+# --------------------------------------------------------------------------------------------------
+plot_result() {
+    local _tsv="${1}"
+    if ! command -v gnuplot &>/dev/null; then
+        echo "gnuplot not found, skip plotting."
+        return 0
+    fi
+
+    local _png="${_BENCH_DIR}/bench.png"
+    local _plots=()
+    local _profile
+    for _profile in "${_PROFILES[@]}"; do
+        _plots+=("'< grep \"^${_profile}\t\" ${_tsv}' using 3:4 with linespoints title '${_profile}'")
+    done
+
+    gnuplot <<EOF
+set terminal png size 960,640
+set output '${_png}'
+set logscale xy
+set xlabel 'input size (bytes)'
+set ylabel 'time (seconds)'
+set key left top
+plot $(IFS=','; echo "${_plots[*]}")
+EOF
+    echo "Plot written to ${_png}"
+}
+
+main() {
+    local _profiles=("${_PROFILES[@]}")
+    if [[ ${#} -eq 1 ]]; then
+        echo "Calling with argument: ${1}"
+        _profiles=("${1}")
+    fi
+
+    echo "Compile mthc program..."
+    if ! make; then
+        echo "${_RED}Failed to compile mthc program.${_RESET}"
+        exit 1
+    fi
+    echo ""
+
+    mkdir -p "${_BENCH_DIR}"
+    if ! ${CC:-cc} -O2 -o "${_BENCH_DIR}/bench_run" scripts/bench_run.c; then
+        echo "${_RED}Failed to compile bench_run.${_RESET}"
+        exit 1
+    fi
+    local _max_bytes
+    _max_bytes="$(size_to_bytes "${_MAX_SIZE}")"
+
+    local _profile _size
+    for _profile in "${_profiles[@]}"; do
+        echo "===== Profile: ${_profile} ====="
+        for _size in "${_ALL_SIZES[@]}"; do
+            if [[ $(size_to_bytes "${_size}") -gt ${_max_bytes} ]]; then
+                break
+            fi
+            run_bench "${_profile}" "${_size}"
+        done
+        echo ""
+    done
+
+    if ! print_result; then
+        exit 1
+    fi
+}
+
+main "$@"
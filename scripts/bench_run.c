@@ -0,0 +1,53 @@
+// bench_run: run a command once and write its wall time in seconds and peak
+// resident set size in KB to result_file, used by bench.sh.
+// Usage: bench_run <result_file> <command> [args...]
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <result_file> <command> [args...]\n", argv[0]);
+    return 2;
+  }
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork failed");
+    return 2;
+  }
+  if (pid == 0) {
+    execvp(argv[2], argv + 2);
+    perror("execvp failed");
+    _exit(127);
+  }
+
+  int status;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    perror("wait4 failed");
+    return 2;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  double seconds =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  FILE *fp = fopen(argv[1], "w");
+  if (!fp) {
+    perror("fopen failed");
+    return 2;
+  }
+  fprintf(fp, "%.6f %ld\n", seconds, usage.ru_maxrss);
+  fclose(fp);
+
+  if (WIFEXITED(status)) {
+    return WEXITSTATUS(status);
+  }
+  return 1;
+}
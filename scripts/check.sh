@@ -1,6 +1,15 @@
 #!/usr/bin/env bash
 
 _TEST_DIR="tests"
+# Fixtures converted with extra options, as "directory:options:extension".
+# Expected output sits next to every fixture, named after it with extension.
+_OPTION_TESTS=(
+    "events:--events:txt"
+    "highlight:--highlight:html"
+    "minify:--minify:html"
+)
+# Extra mthc options for every test, e.g. MTHC_FLAGS=--jobs=4
+_MTHC_FLAGS="${MTHC_FLAGS:-}"
 
 # Result will be in the format of "test_name|status|generated_file|expected_file"
 _TESTS_RESULTS=()
@@ -17,39 +26,250 @@ _RESET=$(tput sgr0)
 # "test_name|status|generated_file|expected_file"
 #
 # Globals:
-#   _TEST_DIR
 #   _TESTS_RESULTS
 #
 # Arguments:
 #   $1: input_file
+#   $2: extra mthc options (optional)
+#   $3: extension of the expected file next to input_file (optional, html)
 # --------------------------------------------------------------------------------------------------
 run_test() {
-    if [[ ${#} -ne 1 ]]; then
-        echo "Usage: ${FUNCNAME[0]} <input_file>"
+    if [[ ${#} -lt 1 || ${#} -gt 3 ]]; then
+        echo "Usage: ${FUNCNAME[0]} <input_file> [options] [extension]"
         return 1
     fi
 
     local _input_file="${1}"
+    local _options="${2:-}"
+    local _extension="${3:-html}"
     local _file_base
     _file_base="$(basename "${_input_file}" .md)"
     local _expected_file
-    _expected_file="${_TEST_DIR}/${_file_base}.html"
+    _expected_file="$(dirname "${_input_file}")/${_file_base}.${_extension}"
     local _generated_file
-    _generated_file="/tmp/mthc_${_file_base}.html"
+    _generated_file="/tmp/mthc_${_file_base}.${_extension}"
 
     echo "===== Testcase: ${_file_base} ====="
     echo "Generate html from test markdown..."
-    ./mthc --test "${_input_file}" 1>"${_generated_file}" 2>/dev/null
+    # shellcheck disable=SC2086
+    ./mthc --test ${_options} ${_MTHC_FLAGS} "${_input_file}" 1>"${_generated_file}" 2>/dev/null
 
     sed -i 's/[[:blank:]]\+$//' "${_generated_file}"
     sed -i 's/[[:blank:]]\+$//' "${_expected_file}"
 
     echo "Compare generated html with expected result..."
-    if ! diff "${_generated_file}" "${_expected_file}" &>/dev/null; then
-        _TEST_RESULTS+=("${_file_base}|failed|${_generated_file}|${_expected_file}")
+    add_result "${_file_base}" "${_generated_file}" "${_expected_file}"
+    echo ""
+}
+
+# --------------------------------------------------------------------------------------------------
+# Record whether generated_file matches expected_file
+#
+# Globals:
+#   _TESTS_RESULTS
+#
+# Arguments:
+#   $1: test_name
+#   $2: generated_file
+#   $3: expected_file
+# --------------------------------------------------------------------------------------------------
+add_result() {
+    if ! diff "${2}" "${3}" &>/dev/null; then
+        _TEST_RESULTS+=("${1}|failed|${2}|${3}")
     else
-        _TEST_RESULTS+=("${_file_base}|passed|${_generated_file}|${_expected_file}")
+        _TEST_RESULTS+=("${1}|passed|${2}|${3}")
     fi
+}
+
+# --------------------------------------------------------------------------------------------------
+# Save the document with --emit-ast and check that rendering it with --from-ast
+# writes the same html as converting the markdown
+#
+# Arguments:
+#   $1: input_file
+# --------------------------------------------------------------------------------------------------
+run_ast_test() {
+    local _input_file="${1}"
+    local _file_base
+    _file_base="$(basename "${_input_file}" .md)"
+    local _ast_file="/tmp/mthc_${_file_base}.ast"
+    local _direct_file="/tmp/mthc_${_file_base}.direct.html"
+    local _generated_file="/tmp/mthc_${_file_base}.from-ast.html"
+
+    echo "===== Testcase: ${_file_base} from ast ====="
+    ./mthc --test --emit-ast="${_ast_file}" "${_input_file}" 1>"${_direct_file}" 2>/dev/null
+    ./mthc --test --from-ast="${_ast_file}" 1>"${_generated_file}" 2>/dev/null
+    add_result "${_file_base}-from-ast" "${_generated_file}" "${_direct_file}"
+    echo ""
+}
+
+# --------------------------------------------------------------------------------------------------
+# Print the ETag mthc writes for file, the FNV-1a hash of its bytes
+#
+# Arguments:
+#   $1: file
+# --------------------------------------------------------------------------------------------------
+etag_of() {
+    local _hash=0xcbf29ce484222325
+    local _byte
+    for _byte in $(od -An -v -tu1 "${1}"); do
+        _hash=$(((_hash ^ _byte) * 0x100000001b3))
+    done
+    printf '"%016x"\n' "${_hash}"
+}
+
+# --------------------------------------------------------------------------------------------------
+# Convert with --precompress=gzip --etag and check that the .gz copy unpacks to
+# the html file and that the .etag file holds its hash
+#
+# Arguments:
+#   $1: input_file
+# --------------------------------------------------------------------------------------------------
+run_precompress_test() {
+    local _input_file="${1}"
+    local _file_base
+    _file_base="$(basename "${_input_file}" .md)"
+    local _output_dir="/tmp/mthc_precompress"
+    local _html_file="${_output_dir}/${_file_base}.html"
+
+    echo "===== Testcase: ${_file_base} precompressed ====="
+    rm -rf "${_output_dir}"
+    mkdir -p "${_output_dir}"
+    ./mthc --test --precompress=gzip --etag --output="${_html_file}" "${_input_file}" 2>/dev/null
+
+    gzip -dc "${_html_file}.gz" 1>"${_output_dir}/${_file_base}.gunzip.html" 2>/dev/null
+    add_result "${_file_base}-gzip" "${_output_dir}/${_file_base}.gunzip.html" "${_html_file}"
+
+    etag_of "${_html_file}" 1>"${_output_dir}/${_file_base}.expected.etag"
+    add_result "${_file_base}-etag" "${_html_file}.etag" "${_output_dir}/${_file_base}.expected.etag"
+    echo ""
+}
+
+# --------------------------------------------------------------------------------------------------
+# Convert the files together with --output-dir, through io_uring where it is available and with
+# --no-io-uring, and check every page against converting its file alone
+#
+# Arguments:
+#   $@: input_files
+# --------------------------------------------------------------------------------------------------
+run_output_dir_test() {
+    local _work_dir="/tmp/mthc_output_dir"
+    local _mode
+    local _file
+
+    rm -rf "${_work_dir}"
+    mkdir -p "${_work_dir}"
+    for _mode in "" "--no-io-uring"; do
+        echo "===== Testcase: output-dir ${_mode} ====="
+        # shellcheck disable=SC2086
+        ./mthc --test ${_mode} --output-dir="${_work_dir}/out${_mode}" "${@}" 1>/dev/null 2>&1
+        for _file in "${@}"; do
+            local _file_base
+            _file_base="$(basename "${_file}" .md)"
+            ./mthc --test "${_file}" 1>"${_work_dir}/${_file_base}.html" 2>/dev/null
+            add_result "${_file_base}-output-dir${_mode}" \
+                "${_work_dir}/out${_mode}/${_file%.md}.html" "${_work_dir}/${_file_base}.html"
+        done
+        echo ""
+    done
+}
+
+# --------------------------------------------------------------------------------------------------
+# Render edited versions of each file one after another the way --watch does, and check every
+# render against converting that version from scratch
+#
+# Arguments:
+#   $@: input_files
+# --------------------------------------------------------------------------------------------------
+run_watch_test() {
+    local _work_dir="/tmp/mthc_watch"
+    local _file
+
+    echo "===== Testcase: watch ====="
+    if ! make watch_test 1>/dev/null; then
+        echo "${_RED}Failed to compile watch_test program.${_RESET}"
+        return
+    fi
+    rm -rf "${_work_dir}"
+    mkdir -p "${_work_dir}"
+    for _file in "${@}"; do
+        local _file_base
+        _file_base="$(basename "${_file}" .md)"
+        local _versions=("${_file}")
+        local _lines
+        _lines="$(wc -l <"${_file}")"
+        local _middle=$((_lines / 2 + 1))
+
+        awk -v n="${_middle}" 'NR == n { print ""; print "Inserted *paragraph*"; print "" } { print }' \
+            "${_file}" 1>"${_work_dir}/${_file_base}.inserted.md"
+        sed "${_middle}d" "${_file}" 1>"${_work_dir}/${_file_base}.deleted.md"
+        { cat "${_file}"; echo "Appended line"; } 1>"${_work_dir}/${_file_base}.appended.md"
+        { cat "${_file}"; echo ""; echo "[watch]: https://example.com/watch"; } \
+            1>"${_work_dir}/${_file_base}.reference.md"
+        _versions+=("${_work_dir}/${_file_base}.inserted.md" "${_file}"
+            "${_work_dir}/${_file_base}.deleted.md" "${_file}"
+            "${_work_dir}/${_file_base}.appended.md" "${_work_dir}/${_file_base}.reference.md" "${_file}")
+
+        ./watch_test "${_versions[@]}" 1>"${_work_dir}/${_file_base}.out" 2>&1
+        add_result "${_file_base}-watch" "${_work_dir}/${_file_base}.out" /dev/null
+    done
+    ./watch_test "${@}" 1>"${_work_dir}/all.out" 2>&1
+    add_result "watch-every-file" "${_work_dir}/all.out" /dev/null
+    echo ""
+}
+
+# --------------------------------------------------------------------------------------------------
+# Print the hits, misses and stores of the block cache in one conversion
+#
+# Arguments:
+#   $@: mthc arguments
+# --------------------------------------------------------------------------------------------------
+cache_counts() {
+    ./mthc --debug "${@}" 2>&1 1>/dev/null | sed -n 's/^block cache: //p'
+}
+
+# --------------------------------------------------------------------------------------------------
+# Convert with --cache-dir into an empty cache and again from the warm one, both must match a
+# conversion without cache. Then change the reference the large blocks link to: only the blocks
+# using it may miss, and the output must match the changed document. Finally a cache of size 0
+# must be emptied by eviction.
+#
+# Arguments:
+#   $1: input_file
+# --------------------------------------------------------------------------------------------------
+run_cache_test() {
+    local _input_file="${1}"
+    local _file_base
+    _file_base="$(basename "${_input_file}" .md)"
+    local _work_dir="/tmp/mthc_cache"
+    local _cache_dir="${_work_dir}/cache"
+    local _changed_file="${_work_dir}/${_file_base}.changed.md"
+
+    echo "===== Testcase: ${_file_base} cached ====="
+    rm -rf "${_work_dir}"
+    mkdir -p "${_work_dir}"
+    ./mthc --test "${_input_file}" 1>"${_work_dir}/direct.html" 2>/dev/null
+
+    cache_counts --test --cache-dir="${_cache_dir}" "${_input_file}" 1>"${_work_dir}/cold.counts"
+    echo "0 hits, 4 misses, 4 stored" 1>"${_work_dir}/cold.expected"
+    add_result "${_file_base}-cache-cold" "${_work_dir}/cold.counts" "${_work_dir}/cold.expected"
+    ./mthc --test --cache-dir="${_cache_dir}" "${_input_file}" 1>"${_work_dir}/warm.html" 2>/dev/null
+    add_result "${_file_base}-cache-warm" "${_work_dir}/warm.html" "${_work_dir}/direct.html"
+
+    sed 's|https://example.com/guide|https://example.org/changed|' "${_input_file}" 1>"${_changed_file}"
+    ./mthc --test "${_changed_file}" 1>"${_work_dir}/changed.direct.html" 2>/dev/null
+    cache_counts --test --cache-dir="${_cache_dir}" "${_changed_file}" 1>"${_work_dir}/changed.counts"
+    echo "2 hits, 2 misses, 2 stored" 1>"${_work_dir}/changed.expected"
+    add_result "${_file_base}-cache-reference" "${_work_dir}/changed.counts" "${_work_dir}/changed.expected"
+    ./mthc --test --cache-dir="${_cache_dir}" "${_changed_file}" 1>"${_work_dir}/changed.html" 2>/dev/null
+    add_result "${_file_base}-cache-changed" "${_work_dir}/changed.html" "${_work_dir}/changed.direct.html"
+    grep -o "https://example.org/changed" "${_work_dir}/changed.html" | wc -l 1>"${_work_dir}/changed.links"
+    echo "5" 1>"${_work_dir}/changed.links.expected"
+    add_result "${_file_base}-cache-changed-links" "${_work_dir}/changed.links" "${_work_dir}/changed.links.expected"
+
+    ./mthc --test --cache-dir="${_work_dir}/evicted" --cache-size=0 "${_input_file}" 1>/dev/null 2>&1
+    find "${_work_dir}/evicted" -type f ! -name lock 1>"${_work_dir}/evicted.entries"
+    add_result "${_file_base}-cache-evict" "${_work_dir}/evicted.entries" /dev/null
     echo ""
 }
 
@@ -130,8 +350,35 @@ main() {
             continue
         fi
         run_test "${_file}"
+        run_ast_test "${_file}"
     done
 
+    local _option_test
+    for _option_test in "${_OPTION_TESTS[@]}"; do
+        local _dir
+        local _options
+        local _extension
+        IFS=':' read -r _dir _options _extension <<<"${_option_test}"
+        for _file in "${_TEST_DIR}/${_dir}"/*"${1:-}".md; do
+            if [[ -f "${_file}" ]]; then
+                run_test "${_file}" "${_options}" "${_extension}"
+            fi
+        done
+    done
+
+    run_output_dir_test "${_files[@]}"
+    run_watch_test "${_files[@]}"
+
+    for _file in "${_TEST_DIR}/cache"/*"${1:-}".md; do
+        if [[ -f "${_file}" ]]; then
+            run_cache_test "${_file}"
+        fi
+    done
+
+    if [[ -f "${_TEST_DIR}/test-paragraph.md" ]]; then
+        run_precompress_test "${_TEST_DIR}/test-paragraph.md"
+    fi
+
     if ! print_result; then
       exit 1
     fi
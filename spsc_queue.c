@@ -0,0 +1,105 @@
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "spsc_queue.h"
+
+#define CACHE_LINE 64
+#define SPIN_COUNT 64
+#define YIELD_COUNT 64
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_RELAX() __builtin_ia32_pause()
+#else
+#define CPU_RELAX() ((void)0)
+#endif
+
+// head and tail only ever grow, the slot of an index is index & mask. Each
+// side sits on its own cache line so the producer and consumer do not keep
+// stealing the line from each other.
+struct SpscQueue {
+  void **slots;
+  size_t mask;
+  _Alignas(CACHE_LINE) size_t head; // next slot to pop, moved by the consumer
+  _Alignas(CACHE_LINE) size_t tail; // next slot to push, moved by the producer
+};
+
+// new_spsc_queue rounds capacity up to a power of two. Returns NULL on error.
+SpscQueue *new_spsc_queue(size_t capacity) {
+  size_t size = 2;
+  while (size < capacity) {
+    size *= 2;
+  }
+
+  SpscQueue *queue = aligned_alloc(CACHE_LINE, sizeof(SpscQueue));
+  if (!queue) {
+    perror("aligned_alloc failed");
+    return NULL;
+  }
+  queue->slots = malloc(size * sizeof(void *));
+  if (!queue->slots) {
+    perror("malloc failed");
+    free(queue);
+    return NULL;
+  }
+  queue->mask = size - 1;
+  queue->head = 0;
+  queue->tail = 0;
+  return queue;
+}
+
+void free_spsc_queue(SpscQueue *queue) {
+  if (queue == NULL) {
+    return;
+  }
+  free(queue->slots);
+  free(queue);
+}
+
+// Busy waits first since the other side is usually a few lines behind, then
+// gives the cpu away and finally sleeps for stalls as long as a whole stage.
+static void backoff(int *rounds) {
+  if (*rounds < SPIN_COUNT) {
+    CPU_RELAX();
+  } else if (*rounds < SPIN_COUNT + YIELD_COUNT) {
+    sched_yield();
+  } else {
+    struct timespec pause = {.tv_sec = 0, .tv_nsec = 50000};
+    nanosleep(&pause, NULL);
+  }
+  (*rounds)++;
+}
+
+// spsc_queue_push waits while the ring is full
+void spsc_queue_push(SpscQueue *queue, void *item) {
+  size_t tail = queue->tail;
+  int rounds = 0;
+  while (tail - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) > queue->mask) {
+    backoff(&rounds);
+  }
+  queue->slots[tail & queue->mask] = item;
+  __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+// spsc_queue_try_pop takes the oldest item into item, false if the ring is
+// empty
+bool spsc_queue_try_pop(SpscQueue *queue, void **item) {
+  size_t head = queue->head;
+  if (__atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) == head) {
+    return false;
+  }
+  *item = queue->slots[head & queue->mask];
+  __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// spsc_queue_pop waits while the ring is empty
+void *spsc_queue_pop(SpscQueue *queue) {
+  void *item;
+  int rounds = 0;
+  while (!spsc_queue_try_pop(queue, &item)) {
+    backoff(&rounds);
+  }
+  return item;
+}
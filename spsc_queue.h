@@ -0,0 +1,19 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Bounded ring of pointers between exactly one producer thread and one
+// consumer thread. Neither side takes a lock, a full or empty ring is waited
+// on by spinning and then yielding the cpu.
+typedef struct SpscQueue SpscQueue;
+
+SpscQueue *new_spsc_queue(size_t capacity);
+void free_spsc_queue(SpscQueue *queue);
+
+void spsc_queue_push(SpscQueue *queue, void *item);
+void *spsc_queue_pop(SpscQueue *queue);
+bool spsc_queue_try_pop(SpscQueue *queue, void **item);
+
+#endif
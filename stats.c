@@ -0,0 +1,263 @@
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include "alloc_stats.h"
+#include "stats.h"
+
+#define MAX_PHASE_DEPTH 64
+#define BLOCK_TAG_COUNT (PLAIN + 1)
+
+bool stats_enabled = false;
+
+static const char *phase_names[PHASE_COUNT] = {
+    "read", "references", "block", "child", "inline", "render",
+};
+
+// Wall time of every phase excludes its nested phases. CPU time is only
+// taken around phases begun at the top level of a thread, which keeps the
+// per block phase switches to a single vDSO clock read. With worker threads
+// both are summed over all threads.
+static uint64_t phase_wall_ns[PHASE_COUNT];
+static uint64_t phase_cpu_ns[PHASE_COUNT];
+static __thread StatsPhase phase_stack[MAX_PHASE_DEPTH];
+static __thread int phase_depth = 0;
+static __thread uint64_t wall_mark;
+static __thread uint64_t cpu_mark;
+static uint64_t start_wall;
+static uint64_t start_cpu;
+
+static size_t lines_in = 0;
+static size_t bytes_in = 0;
+static size_t bytes_out = 0;
+static size_t block_counts[BLOCK_TAG_COUNT];
+
+static uint64_t clock_ns(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void add_ns(uint64_t *total, uint64_t ns) {
+  __atomic_fetch_add(total, ns, __ATOMIC_RELAXED);
+}
+
+void stats_enable(void) {
+  stats_enabled = true;
+  alloc_stats_enable();
+  start_wall = clock_ns(CLOCK_MONOTONIC);
+  start_cpu = clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+void stats_phase_begin(StatsPhase phase) {
+  uint64_t now = clock_ns(CLOCK_MONOTONIC);
+  if (phase_depth > 0) {
+    add_ns(&phase_wall_ns[phase_stack[phase_depth - 1]], now - wall_mark);
+  } else {
+    cpu_mark = clock_ns(CLOCK_THREAD_CPUTIME_ID);
+  }
+  if (phase_depth < MAX_PHASE_DEPTH) {
+    phase_stack[phase_depth] = phase;
+  }
+  phase_depth++;
+  wall_mark = now;
+}
+
+void stats_phase_end(void) {
+  if (phase_depth == 0) {
+    return;
+  }
+
+  uint64_t now = clock_ns(CLOCK_MONOTONIC);
+  phase_depth--;
+  if (phase_depth < MAX_PHASE_DEPTH) {
+    add_ns(&phase_wall_ns[phase_stack[phase_depth]], now - wall_mark);
+  }
+  if (phase_depth == 0) {
+    add_ns(&phase_cpu_ns[phase_stack[0]],
+           clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_mark);
+  }
+  wall_mark = now;
+}
+
+void stats_set_input(size_t lines, size_t bytes) {
+  lines_in = lines;
+  bytes_in = bytes;
+}
+
+void stats_count_blocks(const MDBlock *block) {
+  for (; block != NULL; block = block->next) {
+    if (block->block < BLOCK_TAG_COUNT) {
+      block_counts[block->block]++;
+    }
+    stats_count_blocks(block->child);
+  }
+}
+
+static ssize_t count_write(void *cookie, const char *buf, size_t size) {
+  size_t written = fwrite(buf, 1, size, (FILE *)cookie);
+  bytes_out += written;
+  return written == 0 && size > 0 ? -1 : (ssize_t)written;
+}
+
+static int count_close(void *cookie) {
+  FILE *fp = cookie;
+  if (fp == stdout) {
+    return fflush(fp);
+  }
+  return fclose(fp);
+}
+
+// stats_count_output wraps fp in a stream counting the bytes written to it.
+// Closing the returned stream closes fp, except stdout which is flushed.
+FILE *stats_count_output(FILE *fp) {
+  cookie_io_functions_t io = {
+      .read = NULL, .write = count_write, .seek = NULL, .close = count_close};
+  FILE *counted = fopencookie(fp, "w", io);
+  if (!counted) {
+    perror("fopencookie failed");
+    return fp;
+  }
+  return counted;
+}
+
+// stats_count_output_bytes counts output written without a stream from
+// stats_count_output
+void stats_count_output_bytes(size_t bytes) { bytes_out += bytes; }
+
+static const char *block_tag_name(BlockTag tag) {
+  switch (tag) {
+  case PARAGRAPH:
+    return "paragraph";
+  case BLOCKQUOTE:
+    return "blockquote";
+  case ORDERED_LIST:
+    return "ordered_list";
+  case UNORDERED_LIST:
+    return "unordered_list";
+  case LIST_ITEM:
+    return "list_item";
+  case CODEBLOCK:
+    return "codeblock";
+  case HORIZONTAL_LINE:
+    return "horizontal_line";
+  case SECTION_BREAK:
+    return "section_break";
+  case LINK_REFERENCE:
+    return "link_reference";
+  case HTML_TAG:
+    return "html_tag";
+  case PLAIN:
+    return "plain";
+  case H1:
+    return "h1";
+  case H2:
+    return "h2";
+  case H3:
+    return "h3";
+  case H4:
+    return "h4";
+  case H5:
+    return "h5";
+  case H6:
+    return "h6";
+  default:
+    return "invalid";
+  }
+}
+
+static void report_text(FILE *fp, uint64_t total_wall, uint64_t total_cpu,
+                        const AllocStats *alloc, long peak_rss_kb) {
+  fprintf(fp, "mthc stats\n");
+  fprintf(fp, "  %-12s %12s %12s\n", "phase", "wall ms", "cpu ms");
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    if (phase_cpu_ns[i] > 0) {
+      fprintf(fp, "  %-12s %12.3f %12.3f\n", phase_names[i],
+              phase_wall_ns[i] / 1e6, phase_cpu_ns[i] / 1e6);
+    } else {
+      fprintf(fp, "  %-12s %12.3f %12s\n", phase_names[i],
+              phase_wall_ns[i] / 1e6, "-");
+    }
+  }
+  fprintf(fp, "  %-12s %12.3f %12.3f\n", "total", total_wall / 1e6,
+          total_cpu / 1e6);
+
+  fprintf(fp, "  lines in: %zu, bytes in: %zu, bytes out: %zu\n", lines_in,
+          bytes_in, bytes_out);
+  fprintf(fp, "  blocks:");
+  for (int i = 0; i < BLOCK_TAG_COUNT; i++) {
+    if (block_counts[i] > 0) {
+      fprintf(fp, " %s=%zu", block_tag_name(i), block_counts[i]);
+    }
+  }
+  fprintf(fp, "\n");
+  fprintf(fp, "  mallocs: %zu, frees: %zu, allocated bytes: %zu\n",
+          alloc->allocs, alloc->frees, alloc->bytes);
+  fprintf(fp, "  peak heap: %zu bytes, peak rss: %ld KB\n", alloc->peak_bytes,
+          peak_rss_kb);
+}
+
+static void report_json(FILE *fp, uint64_t total_wall, uint64_t total_cpu,
+                        const AllocStats *alloc, long peak_rss_kb) {
+  fprintf(fp, "{\n");
+  fprintf(fp, "  \"phases\": {\n");
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    fprintf(fp, "    \"%s\": {\"wall_ms\": %.3f", phase_names[i],
+            phase_wall_ns[i] / 1e6);
+    if (phase_cpu_ns[i] > 0) {
+      fprintf(fp, ", \"cpu_ms\": %.3f", phase_cpu_ns[i] / 1e6);
+    }
+    fprintf(fp, "}%s\n", i + 1 < PHASE_COUNT ? "," : "");
+  }
+  fprintf(fp, "  },\n");
+  fprintf(fp, "  \"total\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f},\n",
+          total_wall / 1e6, total_cpu / 1e6);
+  fprintf(fp, "  \"lines_in\": %zu,\n", lines_in);
+  fprintf(fp, "  \"bytes_in\": %zu,\n", bytes_in);
+  fprintf(fp, "  \"bytes_out\": %zu,\n", bytes_out);
+  fprintf(fp, "  \"blocks\": {");
+  bool first = true;
+  for (int i = 0; i < BLOCK_TAG_COUNT; i++) {
+    if (block_counts[i] > 0) {
+      fprintf(fp, "%s\"%s\": %zu", first ? "" : ", ", block_tag_name(i),
+              block_counts[i]);
+      first = false;
+    }
+  }
+  fprintf(fp, "},\n");
+  fprintf(fp, "  \"mallocs\": %zu,\n", alloc->allocs);
+  fprintf(fp, "  \"frees\": %zu,\n", alloc->frees);
+  fprintf(fp, "  \"allocated_bytes\": %zu,\n", alloc->bytes);
+  fprintf(fp, "  \"peak_heap_bytes\": %zu,\n", alloc->peak_bytes);
+  fprintf(fp, "  \"peak_rss_kb\": %ld\n", peak_rss_kb);
+  fprintf(fp, "}\n");
+}
+
+// stats_report writes the collected stats to stderr, or as JSON to json_path
+// when given. Returns 0 on success, -1 if the JSON file cannot be written.
+int stats_report(const char *json_path) {
+  uint64_t total_wall = clock_ns(CLOCK_MONOTONIC) - start_wall;
+  uint64_t total_cpu = clock_ns(CLOCK_PROCESS_CPUTIME_ID) - start_cpu;
+  AllocStats alloc = alloc_stats_get();
+  struct rusage usage;
+  long peak_rss_kb = getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+
+  if (json_path == NULL) {
+    report_text(stderr, total_wall, total_cpu, &alloc, peak_rss_kb);
+    return 0;
+  }
+
+  FILE *fp = fopen(json_path, "w");
+  if (!fp) {
+    perror("Failed to open stats file");
+    return -1;
+  }
+  report_json(fp, total_wall, total_cpu, &alloc, peak_rss_kb);
+  fclose(fp);
+  return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "md_parser.h"
+
+typedef enum {
+  PHASE_READ,       // loading the input into memory
+  PHASE_REFERENCES, // link reference pre-pass
+  PHASE_BLOCK,      // top level block parsing
+  PHASE_CHILD,      // container child parsing
+  PHASE_INLINE,     // emphasis, image and link parsing
+  PHASE_RENDER,     // html generation
+  PHASE_COUNT,
+} StatsPhase;
+
+extern bool stats_enabled;
+
+// Phases nest, time spent in a nested phase is not counted in its parent.
+// Both macros cost a single branch when stats are off.
+#define STATS_BEGIN(phase)                                                     \
+  do {                                                                         \
+    if (stats_enabled)                                                         \
+      stats_phase_begin(phase);                                                \
+  } while (0)
+#define STATS_END()                                                            \
+  do {                                                                         \
+    if (stats_enabled)                                                         \
+      stats_phase_end();                                                       \
+  } while (0)
+
+void stats_enable(void);
+void stats_phase_begin(StatsPhase phase);
+void stats_phase_end(void);
+
+void stats_set_input(size_t lines, size_t bytes);
+void stats_count_blocks(const MDBlock *block);
+FILE *stats_count_output(FILE *fp);
+void stats_count_output_bytes(size_t bytes);
+
+int stats_report(const char *json_path);
+
+#endif
@@ -551,21 +551,35 @@ const uint8_t *str_move(const uint8_t *str, int offset) {
 
 bool is_utf8_word(ucs4_t ch) { return uc_is_alpha(ch) || uc_is_digit(ch); }
 
-char *convert_id_tag(char *str) {
+// convert_id_tag generates a heading id from the heading text. Surrounding
+// whitespace is skipped, the given string is not modified.
+char *convert_id_tag(const char *str) {
   if (str == NULL) {
     return NULL;
   }
 
-  trim_space_inplace(str);
+  const char *start = str;
+  while (*start && isspace((unsigned char)*start)) {
+    start++;
+  }
+  const char *end = start + strlen(start);
+  while (end > start && isspace((unsigned char)*(end - 1))) {
+    end--;
+  }
 
-  const uint8_t *traverse_ptr = (uint8_t *)str;
-  const size_t str_len = strlen(str);
+  const uint8_t *traverse_ptr = (const uint8_t *)start;
+  const uint8_t *end_ptr = (const uint8_t *)end;
+  const size_t str_len = end - start;
 
   uint8_t *ret_str = malloc(str_len + 1);
+  if (ret_str == NULL) {
+    perror("malloc failed");
+    return NULL;
+  }
   uint8_t *ret_ptr = ret_str;
 
   ucs4_t ch = 0;
-  while (traverse_ptr != NULL) {
+  while (traverse_ptr < end_ptr) {
     const uint8_t *next = u8_next(&ch, traverse_ptr);
     if (!next) {
       break;
@@ -622,6 +636,17 @@ char *trim_space_inplace(char *str) {
   return str;
 }
 
+// fnv1a64 continues the 64 bit FNV-1a hash seed over len bytes of data
+uint64_t fnv1a64(const void *data, size_t len, uint64_t seed) {
+  const unsigned char *p = data;
+  uint64_t hash = seed;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 #ifdef TEST_STR_UTILS
 int main() {
   char *test_str = "emphasis in `inline *code*` should not be emphasized";
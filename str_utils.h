@@ -1,6 +1,8 @@
 #ifndef STR_UTILS_H
 #define STR_UTILS_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <unictype.h>
 #include "logger.h"
 
@@ -46,7 +48,12 @@ const uint8_t *str_move(const uint8_t *str, int offset);
 
 bool is_utf8_word(ucs4_t ch);
 
-char *convert_id_tag(char *str);
+char *convert_id_tag(const char *str);
 char *trim_space_inplace(char *str);
 
+// Start value of an FNV-1a hash, a hash over several pieces passes on the
+// value returned for the previous one
+#define FNV1A64_SEED 14695981039346656037ULL
+uint64_t fnv1a64(const void *data, size_t len, uint64_t seed);
+
 #endif
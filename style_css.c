@@ -1,4 +1,6 @@
 /* auto-generated: do not edit */
+#include "style_css.h"
+
 /* css/catppuccin-theme.css -> default_theme_css */
 const unsigned char default_theme_css[] = {
   0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
@@ -521,3 +523,1494 @@ const unsigned char default_theme_css[] = {
 };
 const unsigned int default_theme_css_len = 6200;
 
+const unsigned char default_theme_css_min[] = {
+  0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x7b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x6f, 0x73, 0x65, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x23, 0x66,
+  0x35, 0x65, 0x30, 0x64, 0x63, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x66, 0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x23, 0x66, 0x32,
+  0x63, 0x64, 0x63, 0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70,
+  0x69, 0x6e, 0x6b, 0x3a, 0x23, 0x66, 0x35, 0x63, 0x32, 0x65, 0x37, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a,
+  0x23, 0x63, 0x62, 0x61, 0x36, 0x66, 0x37, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x72, 0x65, 0x64, 0x3a, 0x23, 0x66, 0x33, 0x38, 0x62, 0x61,
+  0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f,
+  0x6f, 0x6e, 0x3a, 0x23, 0x65, 0x62, 0x61, 0x30, 0x61, 0x63, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x23,
+  0x66, 0x61, 0x62, 0x33, 0x38, 0x37, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x3a, 0x23, 0x66, 0x39, 0x65,
+  0x32, 0x61, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72,
+  0x65, 0x65, 0x6e, 0x3a, 0x23, 0x61, 0x36, 0x65, 0x33, 0x61, 0x31, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x23,
+  0x39, 0x34, 0x65, 0x32, 0x64, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x6b, 0x79, 0x3a, 0x23, 0x38, 0x39, 0x64, 0x63, 0x65, 0x62,
+  0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68,
+  0x69, 0x72, 0x65, 0x3a, 0x23, 0x37, 0x34, 0x63, 0x37, 0x65, 0x63, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x23,
+  0x38, 0x39, 0x62, 0x34, 0x66, 0x61, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6c, 0x61, 0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x23, 0x62,
+  0x34, 0x62, 0x65, 0x66, 0x65, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x23, 0x63, 0x64, 0x64, 0x36, 0x66, 0x34,
+  0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65,
+  0x78, 0x74, 0x31, 0x3a, 0x23, 0x62, 0x61, 0x63, 0x32, 0x64, 0x65, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78,
+  0x74, 0x30, 0x3a, 0x23, 0x61, 0x36, 0x61, 0x64, 0x63, 0x38, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79,
+  0x32, 0x3a, 0x23, 0x39, 0x33, 0x39, 0x39, 0x62, 0x32, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x31,
+  0x3a, 0x23, 0x37, 0x66, 0x38, 0x34, 0x39, 0x63, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a,
+  0x23, 0x36, 0x63, 0x37, 0x30, 0x38, 0x36, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x23,
+  0x35, 0x38, 0x35, 0x62, 0x37, 0x30, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x3a, 0x23, 0x34,
+  0x35, 0x34, 0x37, 0x35, 0x61, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x23, 0x33, 0x31,
+  0x33, 0x32, 0x34, 0x34, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62,
+  0x61, 0x73, 0x65, 0x3a, 0x23, 0x31, 0x65, 0x31, 0x65, 0x32, 0x65, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65,
+  0x3a, 0x23, 0x31, 0x38, 0x31, 0x38, 0x32, 0x35, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x63, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x23, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x62, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x7b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f,
+  0x73, 0x65, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x23, 0x64, 0x63, 0x38,
+  0x61, 0x37, 0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c,
+  0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x23, 0x64, 0x64, 0x37, 0x38,
+  0x37, 0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e,
+  0x6b, 0x3a, 0x23, 0x65, 0x61, 0x37, 0x36, 0x63, 0x62, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a, 0x23, 0x38,
+  0x38, 0x33, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x65, 0x64, 0x3a, 0x23, 0x64, 0x32, 0x30, 0x66, 0x33, 0x39, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e,
+  0x3a, 0x23, 0x65, 0x36, 0x34, 0x35, 0x35, 0x33, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x23, 0x66, 0x65,
+  0x36, 0x34, 0x30, 0x62, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79,
+  0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x3a, 0x23, 0x64, 0x66, 0x38, 0x65, 0x31,
+  0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65,
+  0x6e, 0x3a, 0x23, 0x34, 0x30, 0x61, 0x30, 0x32, 0x62, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x23, 0x31, 0x37,
+  0x39, 0x32, 0x39, 0x39, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x6b, 0x79, 0x3a, 0x23, 0x30, 0x34, 0x61, 0x35, 0x65, 0x35, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69, 0x72,
+  0x65, 0x3a, 0x23, 0x32, 0x30, 0x39, 0x66, 0x62, 0x35, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x23, 0x31, 0x65,
+  0x36, 0x36, 0x66, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c,
+  0x61, 0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x23, 0x37, 0x32, 0x38,
+  0x37, 0x66, 0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x23, 0x34, 0x63, 0x34, 0x66, 0x36, 0x39, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74,
+  0x31, 0x3a, 0x23, 0x35, 0x63, 0x35, 0x66, 0x37, 0x37, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x30,
+  0x3a, 0x23, 0x36, 0x63, 0x36, 0x66, 0x38, 0x35, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x32, 0x3a,
+  0x23, 0x37, 0x63, 0x37, 0x66, 0x39, 0x33, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x31, 0x3a, 0x23,
+  0x38, 0x63, 0x38, 0x66, 0x61, 0x31, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a, 0x23, 0x39,
+  0x63, 0x61, 0x30, 0x62, 0x30, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x23, 0x61, 0x63,
+  0x62, 0x30, 0x62, 0x65, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x3a, 0x23, 0x62, 0x63, 0x63,
+  0x30, 0x63, 0x63, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x23, 0x65, 0x66, 0x66, 0x31,
+  0x66, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x61, 0x73,
+  0x65, 0x3a, 0x23, 0x65, 0x36, 0x65, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65, 0x3a, 0x23,
+  0x65, 0x36, 0x65, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x63, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x23, 0x64, 0x63, 0x65, 0x30,
+  0x65, 0x38, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62,
+  0x61, 0x73, 0x65, 0x29, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x78,
+  0x74, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69,
+  0x6c, 0x79, 0x3a, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x75, 0x69,
+  0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b,
+  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+  0x31, 0x2e, 0x36, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30,
+  0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x72, 0x65,
+  0x6d, 0x7d, 0x68, 0x31, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+  0x33, 0x72, 0x65, 0x6d, 0x7d, 0x68, 0x32, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d, 0x68, 0x33, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x68, 0x34,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x7d,
+  0x68, 0x35, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68,
+  0x69, 0x72, 0x65, 0x29, 0x7d, 0x68, 0x36, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x6c, 0x61, 0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x2c, 0x70, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x3a, 0x30, 0x2e, 0x32, 0x65, 0x6d, 0x20, 0x30, 0x2e, 0x34, 0x65, 0x6d,
+  0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69,
+  0x75, 0x73, 0x3a, 0x34, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+  0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x27, 0x43, 0x6f, 0x75, 0x72,
+  0x69, 0x65, 0x72, 0x20, 0x4e, 0x65, 0x77, 0x27, 0x2c, 0x6d, 0x6f, 0x6e,
+  0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x7d, 0x70, 0x72, 0x65, 0x7b,
+  0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29,
+  0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x65, 0x6d,
+  0x3b, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x2d, 0x78, 0x3a,
+  0x61, 0x75, 0x74, 0x6f, 0x7d, 0x61, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x61, 0x70, 0x70, 0x68, 0x69, 0x72, 0x65, 0x29, 0x3b, 0x74, 0x65, 0x78,
+  0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65,
+  0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f, 0x73, 0x65, 0x77, 0x61,
+  0x74, 0x65, 0x72, 0x29, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65,
+  0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x6e, 0x6f, 0x6e,
+  0x65, 0x7d, 0x6e, 0x61, 0x76, 0x7b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x3a, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3b, 0x74, 0x6f, 0x70,
+  0x3a, 0x30, 0x3b, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x30, 0x3b, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x68, 0x65, 0x69,
+  0x67, 0x68, 0x74, 0x3a, 0x36, 0x30, 0x70, 0x78, 0x3b, 0x64, 0x69, 0x73,
+  0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75,
+  0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x65, 0x6e, 0x64, 0x3b, 0x61,
+  0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63,
+  0x65, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74,
+  0x30, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
+  0x3a, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61,
+  0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b,
+  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x38,
+  0x30, 0x70, 0x78, 0x7d, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d,
+  0x74, 0x68, 0x65, 0x6d, 0x65, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+  0x32, 0x38, 0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+  0x32, 0x38, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a,
+  0x30, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f,
+  0x72, 0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x2e, 0x68,
+  0x69, 0x64, 0x64, 0x65, 0x6e, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x34, 0x70, 0x78, 0x20, 0x73, 0x6f,
+  0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64,
+  0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x31, 0x65, 0x6d,
+  0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e, 0x29,
+  0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x2e, 0x35, 0x65,
+  0x6d, 0x20, 0x30, 0x7d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x2c, 0x65,
+  0x6d, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e,
+  0x29, 0x7d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x7b, 0x77, 0x69, 0x64, 0x74,
+  0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65,
+  0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x3a, 0x63,
+  0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+  0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x31, 0x65, 0x6d, 0x7d, 0x74,
+  0x68, 0x2c, 0x74, 0x64, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a,
+  0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66,
+  0x61, 0x63, 0x65, 0x32, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+  0x67, 0x3a, 0x30, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x7d, 0x74, 0x68, 0x7b,
+  0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x29,
+  0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74,
+  0x31, 0x29, 0x7d, 0x74, 0x72, 0x3a, 0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68,
+  0x69, 0x6c, 0x64, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x29, 0x7b, 0x62, 0x61,
+  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x7d, 0x68,
+  0x72, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x6e,
+  0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70,
+  0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e,
+  0x6b, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x32, 0x72,
+  0x65, 0x6d, 0x20, 0x30, 0x7d, 0x75, 0x6c, 0x2c, 0x6f, 0x6c, 0x7b, 0x6c,
+  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31,
+  0x2e, 0x37, 0x7d, 0x75, 0x6c, 0x20, 0x6c, 0x69, 0x3a, 0x3a, 0x6d, 0x61,
+  0x72, 0x6b, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e,
+  0x6b, 0x29, 0x7d, 0x6f, 0x6c, 0x20, 0x6c, 0x69, 0x3a, 0x3a, 0x6d, 0x61,
+  0x72, 0x6b, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e,
+  0x6b, 0x29, 0x7d, 0x69, 0x6d, 0x67, 0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77,
+  0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x68, 0x65,
+  0x69, 0x67, 0x68, 0x74, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x2e, 0x34, 0x72, 0x65, 0x6d, 0x20,
+  0x30, 0x7d, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72,
+  0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x39,
+  0x36, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a,
+  0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69,
+  0x6e, 0x67, 0x3a, 0x30, 0x2e, 0x38, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72,
+  0x65, 0x6d, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0x62,
+  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66,
+  0x61, 0x63, 0x65, 0x30, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x65, 0x64, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6c, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x6c, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63,
+  0x68, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x6f, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x6b, 0x79, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x70, 0x75, 0x6e, 0x63, 0x74, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x31,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x72, 0x65, 0x67, 0x65, 0x78,
+  0x70, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72,
+  0x65, 0x65, 0x6e, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x2e, 0x65, 0x73, 0x63,
+  0x61, 0x70, 0x65, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65,
+  0x65, 0x6e, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x73, 0x75, 0x62, 0x73, 0x74, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x30, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x79,
+  0x6d, 0x62, 0x6f, 0x6c, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61,
+  0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x6c, 0x61,
+  0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74,
+  0x69, 0x74, 0x6c, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75,
+  0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2e, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f,
+  0x77, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2e, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c,
+  0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65,
+  0x6e, 0x74, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c,
+  0x61, 0x79, 0x32, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x64, 0x6f, 0x63, 0x74, 0x61, 0x67, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6d, 0x65, 0x74, 0x61, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c,
+  0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67,
+  0x72, 0x65, 0x65, 0x6e, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x6f, 0x64,
+  0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x65, 0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73,
+  0x74, 0x72, 0x6f, 0x6e, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65,
+  0x64, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67,
+  0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c, 0x64, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x6c, 0x69, 0x6e, 0x6b, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70,
+  0x70, 0x68, 0x69, 0x72, 0x65, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x71, 0x75, 0x6f, 0x74, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72,
+  0x65, 0x65, 0x6e, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x74, 0x61, 0x67, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x69, 0x64, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x2d, 0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x66, 0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61, 0x6d,
+  0x69, 0x6e, 0x67, 0x6f, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29,
+  0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
+  0x72, 0x67, 0x62, 0x28, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e,
+  0x29, 0x20, 0x72, 0x20, 0x67, 0x20, 0x62, 0x2f, 0x31, 0x35, 0x25, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x64, 0x65, 0x6c, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x72, 0x67, 0x62, 0x28, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x65, 0x64, 0x29, 0x20, 0x72, 0x20, 0x67, 0x20, 0x62, 0x2f, 0x31,
+  0x35, 0x25, 0x29, 0x7d
+};
+const unsigned int default_theme_css_min_len = 4804;
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_0_base */
+static const unsigned char default_theme_css_0_base[] = {
+  0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f, 0x73, 0x65, 0x77, 0x61, 0x74, 0x65,
+  0x72, 0x3a, 0x20, 0x23, 0x66, 0x35, 0x65, 0x30, 0x64, 0x63, 0x3b, 0x0a,
+  0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61, 0x6d,
+  0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x20, 0x20, 0x23, 0x66, 0x32, 0x63, 0x64,
+  0x63, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x70, 0x69, 0x6e, 0x6b, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x66, 0x35, 0x63, 0x32, 0x65, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x63, 0x62, 0x61, 0x36, 0x66, 0x37, 0x3b, 0x0a,
+  0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x3a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x66, 0x33, 0x38, 0x62,
+  0x61, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x65, 0x62, 0x61, 0x30, 0x61, 0x63, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x66, 0x61, 0x62, 0x33, 0x38, 0x37, 0x3b, 0x0a,
+  0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c,
+  0x6f, 0x77, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x66, 0x39, 0x65, 0x32,
+  0x61, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x67, 0x72, 0x65, 0x65, 0x6e, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x61, 0x36, 0x65, 0x33, 0x61, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x39, 0x34, 0x65, 0x32, 0x64, 0x35, 0x3b, 0x0a,
+  0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x6b, 0x79, 0x3a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x38, 0x39, 0x64, 0x63,
+  0x65, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x61, 0x70, 0x70, 0x68, 0x69, 0x72, 0x65, 0x3a, 0x20, 0x20, 0x23,
+  0x37, 0x34, 0x63, 0x37, 0x65, 0x63, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x38, 0x39, 0x62, 0x34, 0x66, 0x61, 0x3b, 0x0a,
+  0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c, 0x61, 0x76, 0x65,
+  0x6e, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x20, 0x23, 0x62, 0x34, 0x62, 0x65,
+  0x66, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x63, 0x64, 0x64, 0x36, 0x66, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74,
+  0x31, 0x3a, 0x20, 0x20, 0x23, 0x62, 0x61, 0x63, 0x32, 0x64, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62,
+  0x74, 0x65, 0x78, 0x74, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x61, 0x36, 0x61,
+  0x64, 0x63, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x32, 0x3a, 0x20, 0x20,
+  0x23, 0x39, 0x33, 0x39, 0x39, 0x62, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79,
+  0x31, 0x3a, 0x20, 0x20, 0x23, 0x37, 0x66, 0x38, 0x34, 0x39, 0x63, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65,
+  0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x36, 0x63, 0x37,
+  0x30, 0x38, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x20, 0x20,
+  0x23, 0x35, 0x38, 0x35, 0x62, 0x37, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65,
+  0x31, 0x3a, 0x20, 0x20, 0x23, 0x34, 0x35, 0x34, 0x37, 0x35, 0x61, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72,
+  0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x33, 0x31, 0x33,
+  0x32, 0x34, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x31, 0x65, 0x31, 0x65, 0x32, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65, 0x3a,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x31, 0x38, 0x31, 0x38, 0x32, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x63, 0x72, 0x75,
+  0x73, 0x74, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x62, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x62, 0x6f, 0x64, 0x79,
+  0x2e, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f, 0x73, 0x65, 0x77, 0x61, 0x74,
+  0x65, 0x72, 0x3a, 0x20, 0x23, 0x64, 0x63, 0x38, 0x61, 0x37, 0x38, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61,
+  0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x20, 0x20, 0x23, 0x64, 0x64, 0x37,
+  0x38, 0x37, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x65, 0x61, 0x37, 0x36, 0x63, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x38, 0x38, 0x33, 0x39, 0x65, 0x66, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x64, 0x32, 0x30,
+  0x66, 0x33, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e, 0x3a, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x65, 0x36, 0x34, 0x35, 0x35, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x66, 0x65, 0x36, 0x34, 0x30, 0x62, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c,
+  0x6c, 0x6f, 0x77, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x64, 0x66, 0x38,
+  0x65, 0x31, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x34, 0x30, 0x61, 0x30, 0x32, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x31, 0x37, 0x39, 0x32, 0x39, 0x39, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x6b, 0x79,
+  0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x30, 0x34, 0x61,
+  0x35, 0x65, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69, 0x72, 0x65, 0x3a, 0x20, 0x20,
+  0x23, 0x32, 0x30, 0x39, 0x66, 0x62, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x31, 0x65, 0x36, 0x36, 0x66, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c, 0x61, 0x76,
+  0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x20, 0x23, 0x37, 0x32, 0x38,
+  0x37, 0x66, 0x64, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x23, 0x34, 0x63, 0x34, 0x66, 0x36, 0x39, 0x3b, 0x0a, 0x20, 0x20,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78,
+  0x74, 0x31, 0x3a, 0x20, 0x20, 0x23, 0x35, 0x63, 0x35, 0x66, 0x37, 0x37,
+  0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x62, 0x74, 0x65, 0x78, 0x74, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x36, 0x63,
+  0x36, 0x66, 0x38, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x32, 0x3a, 0x20,
+  0x20, 0x23, 0x37, 0x63, 0x37, 0x66, 0x39, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61,
+  0x79, 0x31, 0x3a, 0x20, 0x20, 0x23, 0x38, 0x63, 0x38, 0x66, 0x61, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76,
+  0x65, 0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x39, 0x63,
+  0x61, 0x30, 0x62, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x20,
+  0x20, 0x23, 0x61, 0x63, 0x62, 0x30, 0x62, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63,
+  0x65, 0x31, 0x3a, 0x20, 0x20, 0x23, 0x62, 0x63, 0x63, 0x30, 0x63, 0x63,
+  0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x20, 0x20, 0x23, 0x65, 0x66,
+  0x66, 0x31, 0x66, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x23, 0x65, 0x36, 0x65, 0x39, 0x65, 0x66, 0x3b, 0x0a, 0x20, 0x20,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65,
+  0x3a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x65, 0x36, 0x65, 0x39, 0x65, 0x66,
+  0x3b, 0x0a, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x63, 0x72,
+  0x75, 0x73, 0x74, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x64, 0x63,
+  0x65, 0x30, 0x65, 0x38, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x62, 0x6f, 0x64,
+  0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x61,
+  0x73, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x2d, 0x75, 0x69, 0x2c, 0x20, 0x73, 0x61, 0x6e,
+  0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x6c,
+  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x31, 0x2e, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69,
+  0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+  0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_min_0_base */
+static const unsigned char default_theme_css_min_0_base[] = {
+  0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x7b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x6f, 0x73, 0x65, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x23, 0x66,
+  0x35, 0x65, 0x30, 0x64, 0x63, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x66, 0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x23, 0x66, 0x32,
+  0x63, 0x64, 0x63, 0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70,
+  0x69, 0x6e, 0x6b, 0x3a, 0x23, 0x66, 0x35, 0x63, 0x32, 0x65, 0x37, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a,
+  0x23, 0x63, 0x62, 0x61, 0x36, 0x66, 0x37, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x72, 0x65, 0x64, 0x3a, 0x23, 0x66, 0x33, 0x38, 0x62, 0x61,
+  0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f,
+  0x6f, 0x6e, 0x3a, 0x23, 0x65, 0x62, 0x61, 0x30, 0x61, 0x63, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x23,
+  0x66, 0x61, 0x62, 0x33, 0x38, 0x37, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x3a, 0x23, 0x66, 0x39, 0x65,
+  0x32, 0x61, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72,
+  0x65, 0x65, 0x6e, 0x3a, 0x23, 0x61, 0x36, 0x65, 0x33, 0x61, 0x31, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x23,
+  0x39, 0x34, 0x65, 0x32, 0x64, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x6b, 0x79, 0x3a, 0x23, 0x38, 0x39, 0x64, 0x63, 0x65, 0x62,
+  0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68,
+  0x69, 0x72, 0x65, 0x3a, 0x23, 0x37, 0x34, 0x63, 0x37, 0x65, 0x63, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x23,
+  0x38, 0x39, 0x62, 0x34, 0x66, 0x61, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6c, 0x61, 0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x23, 0x62,
+  0x34, 0x62, 0x65, 0x66, 0x65, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x23, 0x63, 0x64, 0x64, 0x36, 0x66, 0x34,
+  0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65,
+  0x78, 0x74, 0x31, 0x3a, 0x23, 0x62, 0x61, 0x63, 0x32, 0x64, 0x65, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78,
+  0x74, 0x30, 0x3a, 0x23, 0x61, 0x36, 0x61, 0x64, 0x63, 0x38, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79,
+  0x32, 0x3a, 0x23, 0x39, 0x33, 0x39, 0x39, 0x62, 0x32, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x31,
+  0x3a, 0x23, 0x37, 0x66, 0x38, 0x34, 0x39, 0x63, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a,
+  0x23, 0x36, 0x63, 0x37, 0x30, 0x38, 0x36, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x23,
+  0x35, 0x38, 0x35, 0x62, 0x37, 0x30, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x3a, 0x23, 0x34,
+  0x35, 0x34, 0x37, 0x35, 0x61, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x23, 0x33, 0x31,
+  0x33, 0x32, 0x34, 0x34, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62,
+  0x61, 0x73, 0x65, 0x3a, 0x23, 0x31, 0x65, 0x31, 0x65, 0x32, 0x65, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65,
+  0x3a, 0x23, 0x31, 0x38, 0x31, 0x38, 0x32, 0x35, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x63, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x23, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x62, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x6c, 0x69,
+  0x67, 0x68, 0x74, 0x7b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f,
+  0x73, 0x65, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x23, 0x64, 0x63, 0x38,
+  0x61, 0x37, 0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c,
+  0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x3a, 0x23, 0x64, 0x64, 0x37, 0x38,
+  0x37, 0x38, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e,
+  0x6b, 0x3a, 0x23, 0x65, 0x61, 0x37, 0x36, 0x63, 0x62, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x3a, 0x23, 0x38,
+  0x38, 0x33, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x65, 0x64, 0x3a, 0x23, 0x64, 0x32, 0x30, 0x66, 0x33, 0x39, 0x3b,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e,
+  0x3a, 0x23, 0x65, 0x36, 0x34, 0x35, 0x35, 0x33, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x3a, 0x23, 0x66, 0x65,
+  0x36, 0x34, 0x30, 0x62, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79,
+  0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x3a, 0x23, 0x64, 0x66, 0x38, 0x65, 0x31,
+  0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65,
+  0x6e, 0x3a, 0x23, 0x34, 0x30, 0x61, 0x30, 0x32, 0x62, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x3a, 0x23, 0x31, 0x37,
+  0x39, 0x32, 0x39, 0x39, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x6b, 0x79, 0x3a, 0x23, 0x30, 0x34, 0x61, 0x35, 0x65, 0x35, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69, 0x72,
+  0x65, 0x3a, 0x23, 0x32, 0x30, 0x39, 0x66, 0x62, 0x35, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x3a, 0x23, 0x31, 0x65,
+  0x36, 0x36, 0x66, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c,
+  0x61, 0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x23, 0x37, 0x32, 0x38,
+  0x37, 0x66, 0x64, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x23, 0x34, 0x63, 0x34, 0x66, 0x36, 0x39, 0x3b, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74,
+  0x31, 0x3a, 0x23, 0x35, 0x63, 0x35, 0x66, 0x37, 0x37, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x30,
+  0x3a, 0x23, 0x36, 0x63, 0x36, 0x66, 0x38, 0x35, 0x3b, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x32, 0x3a,
+  0x23, 0x37, 0x63, 0x37, 0x66, 0x39, 0x33, 0x3b, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x31, 0x3a, 0x23,
+  0x38, 0x63, 0x38, 0x66, 0x61, 0x31, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x30, 0x3a, 0x23, 0x39,
+  0x63, 0x61, 0x30, 0x62, 0x30, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x32, 0x3a, 0x23, 0x61, 0x63,
+  0x62, 0x30, 0x62, 0x65, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x3a, 0x23, 0x62, 0x63, 0x63,
+  0x30, 0x63, 0x63, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x3a, 0x23, 0x65, 0x66, 0x66, 0x31,
+  0x66, 0x35, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x61, 0x73,
+  0x65, 0x3a, 0x23, 0x65, 0x36, 0x65, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x6e, 0x74, 0x6c, 0x65, 0x3a, 0x23,
+  0x65, 0x36, 0x65, 0x39, 0x65, 0x66, 0x3b, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x63, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x23, 0x64, 0x63, 0x65, 0x30,
+  0x65, 0x38, 0x7d, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62,
+  0x61, 0x73, 0x65, 0x29, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x78,
+  0x74, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69,
+  0x6c, 0x79, 0x3a, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x75, 0x69,
+  0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b,
+  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+  0x31, 0x2e, 0x36, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30,
+  0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x72, 0x65,
+  0x6d, 0x7d
+};
+
+/* css/catppuccin-theme.css @group headings -> default_theme_css_1_headings */
+static const unsigned char default_theme_css_1_headings[] = {
+  0x2f, 0x2a, 0x20, 0x68, 0x31, 0x2c, 0x20, 0x68, 0x32, 0x2c, 0x20, 0x68,
+  0x33, 0x2c, 0x20, 0x68, 0x34, 0x2c, 0x20, 0x68, 0x35, 0x2c, 0x20, 0x68,
+  0x36, 0x20, 0x7b, 0x20, 0x2a, 0x2f, 0x0a, 0x2f, 0x2a, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c, 0x61, 0x76, 0x65, 0x6e, 0x64, 0x65,
+  0x72, 0x29, 0x3b, 0x20, 0x2a, 0x2f, 0x0a, 0x2f, 0x2a, 0x20, 0x20, 0x20,
+  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20,
+  0x32, 0x72, 0x65, 0x6d, 0x3b, 0x20, 0x2a, 0x2f, 0x0a, 0x2f, 0x2a, 0x20,
+  0x7d, 0x20, 0x2a, 0x2f, 0x0a, 0x68, 0x31, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20,
+  0x33, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x32, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61,
+  0x63, 0x68, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x33, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c,
+  0x6f, 0x77, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x34, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65,
+  0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x35, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68,
+  0x69, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x36, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c, 0x61, 0x76,
+  0x65, 0x6e, 0x64, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group headings -> default_theme_css_min_1_headings */
+static const unsigned char default_theme_css_min_1_headings[] = {
+  0x68, 0x31, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x33, 0x72,
+  0x65, 0x6d, 0x7d, 0x68, 0x32, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65,
+  0x61, 0x63, 0x68, 0x29, 0x7d, 0x68, 0x33, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x68, 0x34, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x7d, 0x68, 0x35,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69, 0x72,
+  0x65, 0x29, 0x7d, 0x68, 0x36, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6c, 0x61,
+  0x76, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x29, 0x7d
+};
+
+/* css/catppuccin-theme.css @group code -> default_theme_css_2_code */
+static const unsigned char default_theme_css_2_code[] = {
+  0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+  0x20, 0x30, 0x2e, 0x32, 0x65, 0x6d, 0x20, 0x30, 0x2e, 0x34, 0x65, 0x6d,
+  0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72,
+  0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c,
+  0x79, 0x3a, 0x20, 0x27, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20,
+  0x4e, 0x65, 0x77, 0x27, 0x2c, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x70, 0x72, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63,
+  0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31,
+  0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c,
+  0x6f, 0x77, 0x2d, 0x78, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group code -> default_theme_css_min_2_code */
+static const unsigned char default_theme_css_min_2_code[] = {
+  0x63, 0x6f, 0x64, 0x65, 0x2c, 0x70, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69,
+  0x6e, 0x67, 0x3a, 0x30, 0x2e, 0x32, 0x65, 0x6d, 0x20, 0x30, 0x2e, 0x34,
+  0x65, 0x6d, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61,
+  0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70, 0x78, 0x3b, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x27, 0x43, 0x6f,
+  0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 0x4e, 0x65, 0x77, 0x27, 0x2c, 0x6d,
+  0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3b, 0x62, 0x61, 0x63,
+  0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x7d, 0x70, 0x72,
+  0x65, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65,
+  0x30, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31,
+  0x65, 0x6d, 0x3b, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x2d,
+  0x78, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x7d
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_3_base */
+static const unsigned char default_theme_css_3_base[] = {
+  0x61, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x61, 0x70, 0x70, 0x68, 0x69, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x6f, 0x73, 0x65, 0x77,
+  0x61, 0x74, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_min_3_base */
+static const unsigned char default_theme_css_min_3_base[] = {
+  0x61, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69,
+  0x72, 0x65, 0x29, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63,
+  0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x6e, 0x6f, 0x6e, 0x65,
+  0x7d, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x72, 0x6f, 0x73, 0x65, 0x77, 0x61, 0x74, 0x65, 0x72, 0x29, 0x3b,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d
+};
+
+/* css/catppuccin-theme.css @group nav -> default_theme_css_4_nav */
+static const unsigned char default_theme_css_4_nav[] = {
+  0x6e, 0x61, 0x76, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b,
+  0x0a, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x36,
+  0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x0a, 0x20, 0x20,
+  0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74,
+  0x65, 0x6e, 0x74, 0x3a, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x65, 0x6e,
+  0x64, 0x3b, 0x0a, 0x20, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69,
+  0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72,
+  0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group nav -> default_theme_css_min_4_nav */
+static const unsigned char default_theme_css_min_4_nav[] = {
+  0x6e, 0x61, 0x76, 0x7b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x3a, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3b, 0x74, 0x6f, 0x70, 0x3a, 0x30,
+  0x3b, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x30, 0x3b, 0x77, 0x69, 0x64, 0x74,
+  0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68,
+  0x74, 0x3a, 0x36, 0x30, 0x70, 0x78, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74,
+  0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
+  0x66, 0x6c, 0x65, 0x78, 0x2d, 0x65, 0x6e, 0x64, 0x3b, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x7d
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_5_base */
+static const unsigned char default_theme_css_5_base[] = {
+  0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x30,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+  0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20,
+  0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x38, 0x30,
+  0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x6d, 0x61, 0x72,
+  0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20,
+  0x33, 0x36, 0x70, 0x78, 0x3b, 0x20, 0x2a, 0x2f, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_min_5_base */
+static const unsigned char default_theme_css_min_5_base[] = {
+  0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x30, 0x29, 0x3b, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x3b,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x63,
+  0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x38, 0x30, 0x70, 0x78, 0x7d
+};
+
+/* css/catppuccin-theme.css @group nav -> default_theme_css_6_nav */
+static const unsigned char default_theme_css_6_nav[] = {
+  0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+  0x20, 0x32, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x65, 0x69,
+  0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x20,
+  0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x20, 0x32,
+  0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f,
+  0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x2e, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20,
+  0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group nav -> default_theme_css_min_6_nav */
+static const unsigned char default_theme_css_min_6_nav[] = {
+  0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x32, 0x38, 0x70, 0x78,
+  0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x38, 0x70, 0x78,
+  0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20, 0x32, 0x30,
+  0x70, 0x78, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x7d, 0x2e, 0x68, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f,
+  0x6e, 0x65, 0x7d
+};
+
+/* css/catppuccin-theme.css @group blockquote -> default_theme_css_7_blockquote */
+static const unsigned char default_theme_css_7_blockquote[] = {
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65,
+  0x66, 0x74, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69,
+  0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x70, 0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64,
+  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x31,
+  0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d,
+  0x61, 0x72, 0x6f, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x2e, 0x35, 0x65, 0x6d, 0x20,
+  0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group blockquote -> default_theme_css_min_7_blockquote */
+static const unsigned char default_theme_css_min_7_blockquote[] = {
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x7b, 0x62,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x34,
+  0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29,
+  0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66,
+  0x74, 0x3a, 0x31, 0x65, 0x6d, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61,
+  0x72, 0x6f, 0x6f, 0x6e, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x3a, 0x31, 0x2e, 0x35, 0x65, 0x6d, 0x20, 0x30, 0x7d
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_8_base */
+static const unsigned char default_theme_css_8_base[] = {
+  0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x2c, 0x20, 0x65, 0x6d, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f,
+  0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_min_8_base */
+static const unsigned char default_theme_css_min_8_base[] = {
+  0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x2c, 0x65, 0x6d, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6f, 0x6f, 0x6e, 0x29, 0x7d
+};
+
+/* css/catppuccin-theme.css @group table -> default_theme_css_9_table */
+static const unsigned char default_theme_css_9_table[] = {
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0a, 0x20,
+  0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6c, 0x6c,
+  0x61, 0x70, 0x73, 0x65, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70,
+  0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x65, 0x6d, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x74, 0x68, 0x2c, 0x20, 0x74, 0x64, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78,
+  0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65,
+  0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+  0x67, 0x3a, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x74, 0x68, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63,
+  0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65,
+  0x78, 0x74, 0x31, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x74, 0x72, 0x3a,
+  0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x65, 0x76,
+  0x65, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group table -> default_theme_css_min_9_table */
+static const unsigned char default_theme_css_min_9_table[] = {
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+  0x31, 0x30, 0x30, 0x25, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
+  0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x3a, 0x63, 0x6f, 0x6c,
+  0x6c, 0x61, 0x70, 0x73, 0x65, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x31, 0x65, 0x6d, 0x7d, 0x74, 0x68, 0x2c,
+  0x74, 0x64, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70,
+  0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63,
+  0x65, 0x32, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+  0x30, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x7d, 0x74, 0x68, 0x7b, 0x62, 0x61,
+  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x31, 0x29, 0x3b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x31, 0x29,
+  0x7d, 0x74, 0x72, 0x3a, 0x6e, 0x74, 0x68, 0x2d, 0x63, 0x68, 0x69, 0x6c,
+  0x64, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x29, 0x7b, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73,
+  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x7d
+};
+
+/* css/catppuccin-theme.css @group hr -> default_theme_css_10_hr */
+static const unsigned char default_theme_css_10_hr[] = {
+  0x68, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65,
+  0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31,
+  0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+  0x32, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group hr -> default_theme_css_min_10_hr */
+static const unsigned char default_theme_css_min_10_hr[] = {
+  0x68, 0x72, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x6e, 0x6f,
+  0x6e, 0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f,
+  0x70, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69,
+  0x6e, 0x6b, 0x29, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x32,
+  0x72, 0x65, 0x6d, 0x20, 0x30, 0x7d
+};
+
+/* css/catppuccin-theme.css @group lists -> default_theme_css_11_lists */
+static const unsigned char default_theme_css_11_lists[] = {
+  0x75, 0x6c, 0x2c, 0x20, 0x6f, 0x6c, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x6c,
+  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x31, 0x2e, 0x37, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x75, 0x6c, 0x20, 0x6c,
+  0x69, 0x3a, 0x3a, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29,
+  0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x20,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2a, 0x2f, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x6f, 0x6c, 0x20, 0x6c, 0x69, 0x3a, 0x3a, 0x6d, 0x61, 0x72, 0x6b, 0x65,
+  0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70,
+  0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2a, 0x2f,
+  0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group lists -> default_theme_css_min_11_lists */
+static const unsigned char default_theme_css_min_11_lists[] = {
+  0x75, 0x6c, 0x2c, 0x6f, 0x6c, 0x7b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x2e, 0x37, 0x7d, 0x75, 0x6c,
+  0x20, 0x6c, 0x69, 0x3a, 0x3a, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x7d, 0x6f, 0x6c,
+  0x20, 0x6c, 0x69, 0x3a, 0x3a, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x7d
+};
+
+/* css/catppuccin-theme.css @group images -> default_theme_css_12_images */
+static const unsigned char default_theme_css_12_images[] = {
+  0x69, 0x6d, 0x67, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61,
+  0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30,
+  0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68,
+  0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2a, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+  0x31, 0x2e, 0x32, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x20, 0x30, 0x3b, 0x20,
+  0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69,
+  0x6e, 0x3a, 0x20, 0x30, 0x2e, 0x34, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x6c, 0x69, 0x20, 0x69, 0x6d,
+  0x67, 0x20, 0x7b, 0x20, 0x2a, 0x2f, 0x0a, 0x2f, 0x2a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x20,
+  0x30, 0x20, 0x30, 0x2e, 0x34, 0x72, 0x65, 0x6d, 0x3b, 0x20, 0x2a, 0x2f,
+  0x0a, 0x2f, 0x2a, 0x20, 0x7d, 0x20, 0x2a, 0x2f, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group images -> default_theme_css_min_12_images */
+static const unsigned char default_theme_css_min_12_images[] = {
+  0x69, 0x6d, 0x67, 0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74,
+  0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68,
+  0x74, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+  0x6e, 0x3a, 0x30, 0x2e, 0x34, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x7d
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_13_base */
+static const unsigned char default_theme_css_13_base[] = {
+  0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68,
+  0x3a, 0x20, 0x39, 0x36, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x6d,
+  0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74,
+  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x3a, 0x20, 0x30, 0x2e, 0x38, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65,
+  0x6d, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a
+};
+
+/* css/catppuccin-theme.css @group base -> default_theme_css_min_13_base */
+static const unsigned char default_theme_css_min_13_base[] = {
+  0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x7b, 0x6d,
+  0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x39, 0x36, 0x30,
+  0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20,
+  0x61, 0x75, 0x74, 0x6f, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x3a, 0x30, 0x2e, 0x38, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d,
+  0x7d
+};
+
+/* css/catppuccin-theme.css @group highlight -> default_theme_css_14_highlight */
+static const unsigned char default_theme_css_14_highlight[] = {
+  0x2f, 0x2a, 0x20, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x2e, 0x6a, 0x73, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x20, 0x2a,
+  0x2f, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x78, 0x74,
+  0x29, 0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x30, 0x29, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x5f, 0x69, 0x6e,
+  0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
+  0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x6b, 0x79,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x70, 0x75, 0x6e, 0x63, 0x74, 0x75, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x31, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x72, 0x65, 0x67, 0x65, 0x78, 0x70, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x63, 0x68, 0x61, 0x72, 0x2e, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x5f,
+  0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65,
+  0x65, 0x6e, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x62, 0x74,
+  0x65, 0x78, 0x74, 0x30, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x79, 0x6d, 0x62,
+  0x6f, 0x6c, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66,
+  0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x29, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x76,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x6c, 0x61,
+  0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x5f, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74,
+  0x69, 0x74, 0x6c, 0x65, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x5f, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c,
+  0x6f, 0x77, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2e,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x20, 0x7b, 0x0a,
+  0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79,
+  0x32, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x64, 0x6f, 0x63, 0x74, 0x61, 0x67, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x74, 0x61, 0x67, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6e, 0x61, 0x6d,
+  0x65, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61,
+  0x75, 0x76, 0x65, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72,
+  0x65, 0x65, 0x6e, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x65,
+  0x74, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65,
+  0x61, 0x6c, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e,
+  0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x65, 0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73,
+  0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x20, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b, 0x0a, 0x09, 0x66,
+  0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x62, 0x6f, 0x6c, 0x64, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x20,
+  0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70,
+  0x68, 0x69, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x69, 0x74, 0x61, 0x6c,
+  0x69, 0x63, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e,
+  0x29, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x20, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x74, 0x61,
+  0x67, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65,
+  0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x6f, 0x72, 0x2d, 0x69, 0x64, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x20, 0x7b, 0x0a, 0x09,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x70,
+  0x73, 0x65, 0x75, 0x64, 0x6f, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x74, 0x61, 0x67, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61, 0x6d, 0x69,
+  0x6e, 0x67, 0x6f, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61,
+  0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x29, 0x0a, 0x7d, 0x0a, 0x0a, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x64, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x09, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x3b, 0x0a, 0x09, 0x62,
+  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x72,
+  0x67, 0x62, 0x28, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29,
+  0x20, 0x72, 0x20, 0x67, 0x20, 0x62, 0x2f, 0x31, 0x35, 0x25, 0x29, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x7b,
+  0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b,
+  0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x3a, 0x20, 0x72, 0x67, 0x62, 0x28, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x20, 0x72, 0x20, 0x67, 0x20, 0x62, 0x2f, 0x31, 0x35, 0x25, 0x29,
+  0x0a, 0x7d, 0x0a
+};
+
+/* css/catppuccin-theme.css @group highlight -> default_theme_css_min_14_highlight */
+static const unsigned char default_theme_css_min_14_highlight[] = {
+  0x63, 0x6f, 0x64, 0x65, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65,
+  0x30, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x62, 0x75, 0x69, 0x6c,
+  0x74, 0x5f, 0x69, 0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x74, 0x79, 0x70, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x79, 0x65,
+  0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x70, 0x65,
+  0x61, 0x63, 0x68, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x6b, 0x79, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x70, 0x75, 0x6e,
+  0x63, 0x74, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x31, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x70, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x72, 0x65, 0x67, 0x65, 0x78, 0x70, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x6b, 0x29, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x63, 0x68, 0x61, 0x72, 0x2e, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65,
+  0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x73, 0x75, 0x62, 0x73, 0x74, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x75,
+  0x62, 0x74, 0x65, 0x78, 0x74, 0x30, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x79, 0x6d, 0x62, 0x6f,
+  0x6c, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61, 0x6d, 0x69, 0x6e,
+  0x67, 0x6f, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75, 0x76, 0x65, 0x29, 0x7d, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x6c, 0x61, 0x6e, 0x67, 0x75,
+  0x61, 0x67, 0x65, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61, 0x75,
+  0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c,
+  0x6a, 0x73, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f, 0x7b, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74,
+  0x70, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x69, 0x74, 0x6c,
+  0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74,
+  0x69, 0x74, 0x6c, 0x65, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x5f, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74,
+  0x69, 0x74, 0x6c, 0x65, 0x2e, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x5f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x78, 0x74, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x79, 0x32,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x64, 0x6f, 0x63, 0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x72, 0x65, 0x64, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x6d, 0x65, 0x74, 0x61, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x70, 0x65, 0x61, 0x63, 0x68, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29,
+  0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d,
+  0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c,
+  0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73,
+  0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61,
+  0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x62, 0x6c, 0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61,
+  0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65,
+  0x6e, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x7b, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70,
+  0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x65, 0x6d, 0x70,
+  0x68, 0x61, 0x73, 0x69, 0x73, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65,
+  0x64, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x7d, 0x63, 0x6f, 0x64,
+  0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f,
+  0x6e, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64, 0x29, 0x3b,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+  0x62, 0x6f, 0x6c, 0x64, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x7b,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x6c, 0x69, 0x6e,
+  0x6b, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28,
+  0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x73, 0x61, 0x70, 0x70, 0x68, 0x69,
+  0x72, 0x65, 0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x71, 0x75, 0x6f,
+  0x74, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72,
+  0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e,
+  0x29, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x79, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x2d, 0x69, 0x64, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x62,
+  0x6c, 0x75, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x2d, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x74,
+  0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x2d, 0x61, 0x74, 0x74, 0x72, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x6d, 0x61,
+  0x75, 0x76, 0x65, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68,
+  0x6c, 0x6a, 0x73, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x2d, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d,
+  0x74, 0x65, 0x61, 0x6c, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e,
+  0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x2d, 0x74, 0x61, 0x67, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c,
+  0x61, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d,
+  0x2d, 0x63, 0x74, 0x70, 0x2d, 0x66, 0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67,
+  0x6f, 0x29, 0x7d, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a,
+  0x73, 0x2d, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63,
+  0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x3b, 0x62, 0x61,
+  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x72, 0x67, 0x62,
+  0x28, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d,
+  0x63, 0x74, 0x70, 0x2d, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x29, 0x20, 0x72,
+  0x20, 0x67, 0x20, 0x62, 0x2f, 0x31, 0x35, 0x25, 0x29, 0x7d, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x2e, 0x68, 0x6c, 0x6a, 0x73, 0x2d, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x76, 0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65,
+  0x64, 0x29, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+  0x64, 0x3a, 0x72, 0x67, 0x62, 0x28, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x76,
+  0x61, 0x72, 0x28, 0x2d, 0x2d, 0x63, 0x74, 0x70, 0x2d, 0x72, 0x65, 0x64,
+  0x29, 0x20, 0x72, 0x20, 0x67, 0x20, 0x62, 0x2f, 0x31, 0x35, 0x25, 0x29,
+  0x7d
+};
+
+const CssGroup default_theme_css_groups[] = {
+  {"base", default_theme_css_0_base, sizeof(default_theme_css_0_base)},
+  {"headings", default_theme_css_1_headings, sizeof(default_theme_css_1_headings)},
+  {"code", default_theme_css_2_code, sizeof(default_theme_css_2_code)},
+  {"base", default_theme_css_3_base, sizeof(default_theme_css_3_base)},
+  {"nav", default_theme_css_4_nav, sizeof(default_theme_css_4_nav)},
+  {"base", default_theme_css_5_base, sizeof(default_theme_css_5_base)},
+  {"nav", default_theme_css_6_nav, sizeof(default_theme_css_6_nav)},
+  {"blockquote", default_theme_css_7_blockquote, sizeof(default_theme_css_7_blockquote)},
+  {"base", default_theme_css_8_base, sizeof(default_theme_css_8_base)},
+  {"table", default_theme_css_9_table, sizeof(default_theme_css_9_table)},
+  {"hr", default_theme_css_10_hr, sizeof(default_theme_css_10_hr)},
+  {"lists", default_theme_css_11_lists, sizeof(default_theme_css_11_lists)},
+  {"images", default_theme_css_12_images, sizeof(default_theme_css_12_images)},
+  {"base", default_theme_css_13_base, sizeof(default_theme_css_13_base)},
+  {"highlight", default_theme_css_14_highlight, sizeof(default_theme_css_14_highlight)},
+};
+const CssGroup default_theme_css_min_groups[] = {
+  {"base", default_theme_css_min_0_base, sizeof(default_theme_css_min_0_base)},
+  {"headings", default_theme_css_min_1_headings, sizeof(default_theme_css_min_1_headings)},
+  {"code", default_theme_css_min_2_code, sizeof(default_theme_css_min_2_code)},
+  {"base", default_theme_css_min_3_base, sizeof(default_theme_css_min_3_base)},
+  {"nav", default_theme_css_min_4_nav, sizeof(default_theme_css_min_4_nav)},
+  {"base", default_theme_css_min_5_base, sizeof(default_theme_css_min_5_base)},
+  {"nav", default_theme_css_min_6_nav, sizeof(default_theme_css_min_6_nav)},
+  {"blockquote", default_theme_css_min_7_blockquote, sizeof(default_theme_css_min_7_blockquote)},
+  {"base", default_theme_css_min_8_base, sizeof(default_theme_css_min_8_base)},
+  {"table", default_theme_css_min_9_table, sizeof(default_theme_css_min_9_table)},
+  {"hr", default_theme_css_min_10_hr, sizeof(default_theme_css_min_10_hr)},
+  {"lists", default_theme_css_min_11_lists, sizeof(default_theme_css_min_11_lists)},
+  {"images", default_theme_css_min_12_images, sizeof(default_theme_css_min_12_images)},
+  {"base", default_theme_css_min_13_base, sizeof(default_theme_css_min_13_base)},
+  {"highlight", default_theme_css_min_14_highlight, sizeof(default_theme_css_min_14_highlight)},
+};
+const unsigned int default_theme_css_group_count = 15;
+
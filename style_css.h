@@ -1,6 +1,16 @@
 /* auto-generated: do not edit */
 #ifndef STYLE_CSS_H
 #define STYLE_CSS_H
+typedef struct {
+  const char *name;
+  const unsigned char *css;
+  unsigned int len;
+} CssGroup;
 extern const unsigned char default_theme_css[];
 extern const unsigned int  default_theme_css_len;
+extern const unsigned char default_theme_css_min[];
+extern const unsigned int  default_theme_css_min_len;
+extern const CssGroup default_theme_css_groups[];
+extern const CssGroup default_theme_css_min_groups[];
+extern const unsigned int  default_theme_css_group_count;
 #endif
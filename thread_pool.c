@@ -0,0 +1,147 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "thread_pool.h"
+
+struct ThreadPool {
+  pthread_t *workers;
+  int worker_count;
+
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  unsigned long generation; // bumped for every batch
+  int running;              // workers still on the current batch
+  bool shutdown;
+
+  ThreadPoolTask task;
+  void *ctx;
+  size_t count;
+  size_t next; // next unclaimed index, taken atomically
+};
+
+// Every thread claims the next index until the batch runs out, so threads
+// finishing cheap tasks early keep taking work from the slower ones.
+static void run_batch(ThreadPool *pool) {
+  for (;;) {
+    size_t index = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+    if (index >= pool->count) {
+      return;
+    }
+    pool->task(pool->ctx, index);
+  }
+}
+
+static void *worker_main(void *arg) {
+  ThreadPool *pool = arg;
+  unsigned long seen = 0;
+
+  for (;;) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->generation == seen && !pool->shutdown) {
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if (pool->shutdown) {
+      pthread_mutex_unlock(&pool->lock);
+      return NULL;
+    }
+    seen = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+
+    run_batch(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0) {
+      pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+// new_thread_pool starts threads - 1 workers, the caller of thread_pool_run
+// being the last one. Returns NULL on error.
+ThreadPool *new_thread_pool(int threads) {
+  ThreadPool *pool = calloc(1, sizeof(ThreadPool));
+  if (!pool) {
+    perror("calloc failed");
+    return NULL;
+  }
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+
+  if (threads > 1) {
+    pool->workers = malloc((threads - 1) * sizeof(pthread_t));
+    if (!pool->workers) {
+      perror("malloc failed");
+      free_thread_pool(pool);
+      return NULL;
+    }
+  }
+  for (int i = 0; i < threads - 1; i++) {
+    int err = pthread_create(&pool->workers[i], NULL, worker_main, pool);
+    if (err != 0) {
+      fprintf(stderr, "pthread_create failed: %d\n", err);
+      free_thread_pool(pool);
+      return NULL;
+    }
+    pool->worker_count++;
+  }
+
+  return pool;
+}
+
+void free_thread_pool(ThreadPool *pool) {
+  if (pool == NULL) {
+    return;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for (int i = 0; i < pool->worker_count; i++) {
+    pthread_join(pool->workers[i], NULL);
+  }
+
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->start);
+  pthread_cond_destroy(&pool->done);
+  free(pool->workers);
+  free(pool);
+}
+
+int thread_pool_size(const ThreadPool *pool) { return pool->worker_count + 1; }
+
+// thread_pool_run returns once task has run for every index in [0, count).
+// Batches must not be started from inside a task.
+void thread_pool_run(ThreadPool *pool, size_t count, ThreadPoolTask task,
+                     void *ctx) {
+  pthread_mutex_lock(&pool->lock);
+  pool->task = task;
+  pool->ctx = ctx;
+  pool->count = count;
+  pool->next = 0;
+  pool->running = pool->worker_count;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  run_batch(pool);
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0) {
+    pthread_cond_wait(&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+}
+
+// default_job_count is the number of online cpus, at least 1
+int default_job_count(void) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  return cpus > 0 ? (int)cpus : 1;
+}
@@ -0,0 +1,21 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+// Runs task(ctx, index) for every index of a batch. The calling thread works
+// through the batch as well, so a pool of one thread runs everything inline.
+typedef void (*ThreadPoolTask)(void *ctx, size_t index);
+
+typedef struct ThreadPool ThreadPool;
+
+ThreadPool *new_thread_pool(int threads);
+void free_thread_pool(ThreadPool *pool);
+
+int thread_pool_size(const ThreadPool *pool);
+void thread_pool_run(ThreadPool *pool, size_t count, ThreadPoolTask task,
+                     void *ctx);
+
+int default_job_count(void);
+
+#endif
@@ -0,0 +1,80 @@
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+#define MAX_ARGS_LEN 256
+
+bool trace_enabled = false;
+
+static FILE *trace_fp = NULL;
+static double start_us;
+static pid_t trace_pid;
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// trace_open starts a Chrome trace event file at path, it can be loaded in
+// chrome://tracing or ui.perfetto.dev. Returns 0 on success, -1 on error.
+int trace_open(const char *path) {
+  trace_fp = fopen(path, "w");
+  if (!trace_fp) {
+    perror("Failed to open trace file");
+    return -1;
+  }
+
+  start_us = now_us();
+  trace_pid = getpid();
+  // The metadata event comes first so every later event starts with a comma
+  fprintf(trace_fp,
+          "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"
+          "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, "
+          "\"args\": {\"name\": \"mthc\"}}",
+          trace_pid);
+  trace_enabled = true;
+  return 0;
+}
+
+void trace_close(void) {
+  if (!trace_fp) {
+    return;
+  }
+
+  trace_enabled = false;
+  fprintf(trace_fp, "\n]}\n");
+  fclose(trace_fp);
+  trace_fp = NULL;
+}
+
+// Each event is written with a single fprintf, which locks the stream, so
+// events from several threads never interleave.
+void trace_begin(const char *name) {
+  fprintf(trace_fp,
+          ",\n{\"name\": \"%s\", \"ph\": \"B\", \"ts\": %.3f, \"pid\": %d, "
+          "\"tid\": %d}",
+          name, now_us() - start_us, trace_pid, gettid());
+}
+
+// trace_end closes the span opened by trace_begin. args_fmt, when given,
+// formats the members of the JSON args object shown for the span.
+void trace_end(const char *name, const char *args_fmt, ...) {
+  double ts = now_us() - start_us;
+  char args[MAX_ARGS_LEN] = "";
+  if (args_fmt != NULL) {
+    va_list ap;
+    va_start(ap, args_fmt);
+    vsnprintf(args, sizeof(args), args_fmt, ap);
+    va_end(ap);
+  }
+
+  fprintf(trace_fp,
+          ",\n{\"name\": \"%s\", \"ph\": \"E\", \"ts\": %.3f, \"pid\": %d, "
+          "\"tid\": %d, \"args\": {%s}}",
+          name, ts, trace_pid, gettid(), args);
+}
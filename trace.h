@@ -0,0 +1,28 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+extern bool trace_enabled;
+
+// Spans nest and must be closed in order on the thread that opened them.
+// Both macros cost a single branch when tracing is off.
+#define TRACE_BEGIN(name)                                                      \
+  do {                                                                         \
+    if (trace_enabled)                                                         \
+      trace_begin(name);                                                       \
+  } while (0)
+#define TRACE_END(name)                                                        \
+  do {                                                                         \
+    if (trace_enabled)                                                         \
+      trace_end(name, NULL);                                                   \
+  } while (0)
+
+int trace_open(const char *path);
+void trace_close(void);
+
+void trace_begin(const char *name);
+void trace_end(const char *name, const char *args_fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+#endif
@@ -0,0 +1,536 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "file_reader.h"
+#include "logger.h"
+#include "md_parser.h"
+#include "md_regex.h"
+#include "parallel.h"
+#include "watch.h"
+
+// Html of a top level block and the lines it was parsed from
+typedef struct {
+  int start;
+  int end; // line the next block starts at, line count for the last block
+  BlockTag tag;
+  char *html;
+  size_t len;
+} WatchBlock;
+
+typedef struct {
+  WatchBlock *items;
+  size_t count;
+  size_t capacity;
+} WatchBlocks;
+
+// The document as of the last render, kept to re-render only what changed
+typedef struct {
+  const char *input;
+  const char *output;
+  bool fragment;
+  MDSource *source;
+  MDLinkReference *refs;
+  WatchBlocks blocks;
+  char *head; // page boilerplate around the blocks
+  size_t head_len;
+  char *tail;
+  size_t tail_len;
+} Watch;
+
+static int watch_blocks_push(WatchBlocks *blocks, WatchBlock block) {
+  if (blocks->count == blocks->capacity) {
+    size_t capacity = blocks->capacity ? blocks->capacity * 2 : 64;
+    WatchBlock *items = realloc(blocks->items, capacity * sizeof(WatchBlock));
+    if (!items) {
+      perror("Unable to reallocate watch blocks");
+      return -1;
+    }
+    blocks->items = items;
+    blocks->capacity = capacity;
+  }
+  blocks->items[blocks->count++] = block;
+  return 0;
+}
+
+static void free_watch_blocks(WatchBlocks *blocks, size_t from) {
+  for (size_t i = from; i < blocks->count; i++) {
+    free(blocks->items[i].html);
+  }
+  free(blocks->items);
+  *blocks = (WatchBlocks){0};
+}
+
+// render_block completes block and renders it into out, the block is freed
+static int render_block(MDLinkReference *refs, MDBlock *block, int start,
+                        int end, WatchBlock *out) {
+  child_parsing_exec(refs, block);
+  inline_parsing(refs, block);
+
+  *out = (WatchBlock){.start = start, .end = end, .tag = block->block};
+  FILE *fp = open_memstream(&out->html, &out->len);
+  if (!fp) {
+    perror("open_memstream failed");
+    free_mdblocks(block);
+    return -1;
+  }
+  print_html_block(fp, block);
+  free_mdblocks(block);
+  if (fclose(fp) != 0) {
+    perror("Failed to render block");
+    free(out->html);
+    return -1;
+  }
+  return 0;
+}
+
+static long find_watch_block(const WatchBlocks *blocks, int line) {
+  size_t lo = 0;
+  size_t hi = blocks->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (blocks->items[mid].start < line) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo < blocks->count && blocks->items[lo].start == line ? (long)lo : -1;
+}
+
+// A block parsed from line stop_from on that equals an old block delta lines
+// earlier, ending where it ended, sits in the unchanged end of the source
+static bool same_block(const WatchBlock *block, const WatchBlock *old,
+                       int delta) {
+  return old->end + delta == block->end && old->tag == block->tag &&
+         old->len == block->len && memcmp(old->html, block->html, block->len) == 0;
+}
+
+// parse_blocks parses source from line from the way document_block_parsing
+// does and appends the rendered blocks to out. Once a block parsed from
+// stop_from on matches one of old, the parse stops and resume is set to the
+// index of that old block, it stays at old->count otherwise.
+static int parse_blocks(MDSource *source, MDLinkReference *refs, int from,
+                        int stop_from, int delta, const WatchBlocks *old,
+                        size_t *resume, WatchBlocks *out) {
+  *resume = old->count;
+  if (from >= source->line_count) {
+    return 0;
+  }
+
+  PeekReader *reader =
+      new_peek_reader_from_source_range(source, from, DEFAULT_PEEK_COUNT);
+  if (!reader) {
+    fprintf(stderr, "Failed to create peek reader\n");
+    return -1;
+  }
+
+  int status = 0;
+  MDBlock *tail_block = NULL;
+  int tail_start = from;
+  while (reader->count > 0) {
+    int line = from + peek_reader_line_index(reader);
+    MDBlock *new_block = block_parsing(NULL, tail_block, reader, refs);
+    if (new_block == NULL) {
+      continue;
+    }
+
+    if (tail_block != NULL) {
+      WatchBlock block;
+      if (render_block(refs, tail_block, tail_start, line, &block) != 0) {
+        free_mdblocks(new_block);
+        tail_block = NULL;
+        status = -1;
+        break;
+      }
+      long match = tail_start >= stop_from
+                       ? find_watch_block(old, tail_start - delta)
+                       : -1;
+      if (match >= 0 && same_block(&block, &old->items[match], delta)) {
+        free(block.html);
+        free_mdblocks(new_block);
+        tail_block = NULL;
+        *resume = match;
+        break;
+      }
+      if (watch_blocks_push(out, block) != 0) {
+        free(block.html);
+        free_mdblocks(new_block);
+        tail_block = NULL;
+        status = -1;
+        break;
+      }
+    }
+    tail_block = new_block;
+    tail_start = line;
+  }
+
+  if (tail_block != NULL) {
+    WatchBlock block;
+    if (render_block(refs, tail_block, tail_start, source->line_count,
+                     &block) != 0) {
+      status = -1;
+    } else if (watch_blocks_push(out, block) != 0) {
+      free(block.html);
+      status = -1;
+    }
+  }
+  free_peek_reader(reader);
+  return status;
+}
+
+// rebuild renders source against the previous render. Unless the link
+// references changed, blocks ending before the first changed line are kept,
+// and so are the old blocks the new parse lines up with after the last one.
+// The parse restarts at a kept block boundary after a blank line, where
+// like a chunk start in parallel parsing no block is taken to continue.
+static int rebuild(Watch *w, MDSource *source) {
+  MDLinkReference *refs = collect_link_references(NULL, source);
+  WatchBlocks *old = &w->blocks;
+  int from = 0;
+  size_t kept = 0;
+  int stop_from = INT_MAX;
+  int delta = 0;
+
+  if (w->source != NULL && md_link_references_equal(refs, w->refs)) {
+    MDSource *prev = w->source;
+    int shorter = prev->line_count < source->line_count ? prev->line_count
+                                                        : source->line_count;
+    int prefix = 0;
+    while (prefix < shorter &&
+           strcmp(prev->lines[prefix], source->lines[prefix]) == 0) {
+      prefix++;
+    }
+    int suffix = 0;
+    while (suffix < shorter - prefix &&
+           strcmp(prev->lines[prev->line_count - 1 - suffix],
+                  source->lines[source->line_count - 1 - suffix]) == 0) {
+      suffix++;
+    }
+    if (prefix == prev->line_count && prefix == source->line_count) {
+      LOGF("watch: %s unchanged\n", w->input);
+      free_md_link_reference(refs);
+      free_md_source(source);
+      return 1;
+    }
+
+    // The blocks before the restart were completed looking at most a peek
+    // window past their end, which must lie in the unchanged lines
+    for (size_t i = 0; i < old->count; i++) {
+      int start = old->items[i].start;
+      if (start + DEFAULT_PEEK_COUNT + 1 > prefix) {
+        break;
+      }
+      if (start == 0 || is_empty_or_whitespace(prev->lines[start - 1])) {
+        kept = i;
+        from = start;
+      }
+    }
+    stop_from = source->line_count - suffix;
+    delta = source->line_count - prev->line_count;
+  }
+
+  WatchBlocks blocks = {0};
+  int status = 0;
+  for (size_t i = 0; i < kept && status == 0; i++) {
+    status = watch_blocks_push(&blocks, old->items[i]);
+  }
+  size_t resume = old->count;
+  if (status == 0) {
+    status = parse_blocks(source, refs, from, stop_from, delta, old, &resume,
+                          &blocks);
+  }
+  size_t parsed_end = blocks.count;
+  for (size_t i = resume; i < old->count && status == 0; i++) {
+    WatchBlock block = old->items[i];
+    block.start += delta;
+    block.end += delta;
+    status = watch_blocks_push(&blocks, block);
+  }
+  if (status != 0) {
+    // The old blocks stay with the previous render
+    for (size_t i = kept; i < parsed_end; i++) {
+      free(blocks.items[i].html);
+    }
+    free(blocks.items);
+    free_md_link_reference(refs);
+    free_md_source(source);
+    return -1;
+  }
+
+  for (size_t i = kept; i < resume; i++) {
+    free(old->items[i].html);
+  }
+  free(old->items);
+  *old = blocks;
+  free_md_link_reference(w->refs);
+  free_md_source(w->source);
+  w->refs = refs;
+  w->source = source;
+  LOGF("watch: rendered %zu of %zu blocks\n", parsed_end - kept,
+       blocks.count);
+  return 0;
+}
+
+// write_output replaces the output file, so readers never see a partial page
+static int write_output(Watch *w) {
+  size_t len = strlen(w->output) + strlen(".tmp") + 1;
+  char *tmp_path = malloc(len);
+  if (!tmp_path) {
+    perror("malloc failed");
+    return -1;
+  }
+  snprintf(tmp_path, len, "%s.tmp", w->output);
+
+  FILE *fp = fopen(tmp_path, "w");
+  if (!fp) {
+    fprintf(stderr, "Failed to open output file: %s\n", tmp_path);
+    free(tmp_path);
+    return -1;
+  }
+  bool page = !w->fragment && w->blocks.count > 0;
+  if (page) {
+    fwrite(w->head, 1, w->head_len, fp);
+  }
+  for (size_t i = 0; i < w->blocks.count; i++) {
+    fwrite(w->blocks.items[i].html, 1, w->blocks.items[i].len, fp);
+  }
+  if (page) {
+    fwrite(w->tail, 1, w->tail_len, fp);
+  }
+  if (fclose(fp) != 0 || rename(tmp_path, w->output) != 0) {
+    fprintf(stderr, "Failed to write output file %s: %s\n", w->output,
+            strerror(errno));
+    unlink(tmp_path);
+    free(tmp_path);
+    return -1;
+  }
+  free(tmp_path);
+  return 0;
+}
+
+static int render_page_parts(Watch *w, const HtmlOptions *opts) {
+  FILE *fp = open_memstream(&w->head, &w->head_len);
+  if (!fp) {
+    perror("open_memstream failed");
+    return -1;
+  }
+  write_html_head(fp, opts, NULL);
+  if (fclose(fp) != 0) {
+    perror("Failed to render page head");
+    return -1;
+  }
+
+  fp = open_memstream(&w->tail, &w->tail_len);
+  if (!fp) {
+    perror("open_memstream failed");
+    return -1;
+  }
+  write_html_tail(fp, opts);
+  if (fclose(fp) != 0) {
+    perror("Failed to render page tail");
+    return -1;
+  }
+  return 0;
+}
+
+// update reads the input again and rewrites the output if it changed. A
+// file that cannot be read is reported and left for the next change.
+static int update(Watch *w) {
+  FILE *fp = fopen(w->input, "r");
+  if (!fp) {
+    fprintf(stderr, "Failed to open file: %s\n", w->input);
+    return -1;
+  }
+  MDSource *source = new_md_source(fp);
+  fclose(fp);
+  if (!source) {
+    fprintf(stderr, "Failed to read file: %s\n", w->input);
+    return -1;
+  }
+
+  int status = rebuild(w, source);
+  if (status != 0) {
+    return status;
+  }
+  return write_output(w);
+}
+
+// watch_file converts input to output, then converts it again whenever the
+// file is written or replaced, until the process is stopped. Only the top
+// level blocks around the changed lines are parsed and rendered again.
+// Returns 1 if the input cannot be watched.
+int watch_file(const char *input, const char *output, bool fragment,
+               const HtmlOptions *opts) {
+  Watch w = {.input = input, .output = output, .fragment = fragment};
+  if (render_page_parts(&w, opts) != 0) {
+    return 1;
+  }
+
+  // Watch the directory, editors often replace the file by renaming
+  char *dir = strdup(input);
+  if (!dir) {
+    perror("strdup failed");
+    return 1;
+  }
+  char *slash = strrchr(dir, '/');
+  const char *name = input;
+  if (slash) {
+    name = input + (slash - dir) + 1;
+    slash[slash == dir ? 1 : 0] = '\0';
+  } else {
+    strcpy(dir, ".");
+  }
+
+  int fd = inotify_init1(IN_CLOEXEC);
+  if (fd < 0) {
+    perror("inotify_init1 failed");
+    free(dir);
+    return 1;
+  }
+  if (inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+    fprintf(stderr, "Failed to watch %s: %s\n", dir, strerror(errno));
+    close(fd);
+    free(dir);
+    return 1;
+  }
+  free(dir);
+
+  if (update(&w) < 0) {
+    close(fd);
+    return 1;
+  }
+
+  char events[4096]
+      __attribute__((aligned(__alignof__(struct inotify_event))));
+  for (;;) {
+    ssize_t len = read(fd, events, sizeof(events));
+    if (len < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      perror("Failed to read inotify events");
+      break;
+    }
+
+    bool changed = false;
+    for (char *p = events; p < events + len;) {
+      struct inotify_event *event = (struct inotify_event *)p;
+      if (event->len > 0 && strcmp(event->name, name) == 0) {
+        changed = true;
+      }
+      p += sizeof(struct inotify_event) + event->len;
+    }
+    if (changed) {
+      update(&w);
+    }
+  }
+
+  close(fd);
+  free_watch_blocks(&w.blocks, 0);
+  free_md_link_reference(w.refs);
+  free_md_source(w.source);
+  free(w.head);
+  free(w.tail);
+  return 1;
+}
+
+#ifdef TEST_WATCH
+// page_of converts source from scratch the way a single file conversion
+// does, for the watch render to be compared against
+static char *page_of(MDSource *source, const HtmlOptions *opts, size_t *len) {
+  MDLinkReference *refs = collect_link_references(NULL, source);
+  MDBlock *doc = NULL;
+  if (source->line_count > 0) {
+    PeekReader *reader =
+        new_peek_reader_from_source(source, DEFAULT_PEEK_COUNT);
+    if (!reader) {
+      free_md_link_reference(refs);
+      return NULL;
+    }
+    doc = document_block_parsing(refs, reader);
+    free_peek_reader(reader);
+  }
+
+  char *html = NULL;
+  FILE *fp = open_memstream(&html, len);
+  if (fp) {
+    generate_html(fp, doc, opts);
+    fclose(fp);
+  }
+  free_mdblocks(doc);
+  free_md_link_reference(refs);
+  return html;
+}
+
+// Renders each markdown file given in turn, as if the watched file went
+// through those versions, and checks every render against a conversion from
+// scratch. Prints the files whose render differs.
+int main(int argc, char *argv[]) {
+  log_init(false);
+  HtmlOptions opts = {0};
+  Watch w = {.input = "watch_test"};
+  if (render_page_parts(&w, &opts) != 0) {
+    return 1;
+  }
+
+  int failed = 0;
+  for (int i = 1; i < argc; i++) {
+    FILE *fp = fopen(argv[i], "r");
+    if (!fp) {
+      fprintf(stderr, "Failed to open file: %s\n", argv[i]);
+      return 1;
+    }
+    MDSource *source = new_md_source(fp);
+    rewind(fp);
+    MDSource *fresh = new_md_source(fp);
+    fclose(fp);
+    if (!source || !fresh || rebuild(&w, source) < 0) {
+      fprintf(stderr, "Failed to render file: %s\n", argv[i]);
+      return 1;
+    }
+
+    char *page = NULL;
+    size_t page_len = 0;
+    fp = open_memstream(&page, &page_len);
+    if (!fp) {
+      return 1;
+    }
+    if (w.blocks.count > 0) {
+      fwrite(w.head, 1, w.head_len, fp);
+    }
+    for (size_t j = 0; j < w.blocks.count; j++) {
+      fwrite(w.blocks.items[j].html, 1, w.blocks.items[j].len, fp);
+    }
+    if (w.blocks.count > 0) {
+      fwrite(w.tail, 1, w.tail_len, fp);
+    }
+    fclose(fp);
+
+    size_t expected_len = 0;
+    char *expected = page_of(fresh, &opts, &expected_len);
+    if (!expected || expected_len != page_len ||
+        memcmp(expected, page, page_len) != 0) {
+      printf("%s: watch render differs after %s\n", argv[i],
+             i > 1 ? argv[i - 1] : "an empty render");
+      failed = 1;
+    }
+    free(expected);
+    free(page);
+    free_md_source(fresh);
+  }
+
+  free_watch_blocks(&w.blocks, 0);
+  free_md_link_reference(w.refs);
+  free_md_source(w.source);
+  free(w.head);
+  free(w.tail);
+  log_close();
+  return failed;
+}
+#endif // TEST_WATCH
@@ -0,0 +1,11 @@
+#ifndef WATCH_H
+#define WATCH_H
+
+#include <stdbool.h>
+
+#include "html_writer.h"
+
+int watch_file(const char *input, const char *output, bool fragment,
+               const HtmlOptions *opts);
+
+#endif